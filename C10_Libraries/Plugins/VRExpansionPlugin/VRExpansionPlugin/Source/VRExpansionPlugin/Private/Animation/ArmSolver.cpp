@@ -0,0 +1,181 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Animation/ArmSolver.h"
+#include "Async/ParallelFor.h"
+
+void FArmSolverBatch::Reset(int32 ExpectedArms)
+{
+	HMDLocations.Reset(ExpectedArms);
+	HMDRotations.Reset(ExpectedArms);
+	ControllerLocations.Reset(ExpectedArms);
+	ControllerRotations.Reset(ExpectedArms);
+	IsLeftArm.Reset(ExpectedArms);
+
+	ElbowLocations.Reset(ExpectedArms);
+	WristLocations.Reset(ExpectedArms);
+	UpperArmRotations.Reset(ExpectedArms);
+	LowerArmRotations.Reset(ExpectedArms);
+	HandRotations.Reset(ExpectedArms);
+}
+
+int32 FArmSolverBatch::AddAvatar(const FTransform & HMDTransform, const FTransform & LeftControllerTransform, const FTransform & RightControllerTransform)
+{
+	int32 LeftIndex = HMDLocations.Num();
+
+	HMDLocations.Add(HMDTransform.GetLocation());
+	HMDRotations.Add(HMDTransform.GetRotation());
+	ControllerLocations.Add(LeftControllerTransform.GetLocation());
+	ControllerRotations.Add(LeftControllerTransform.GetRotation());
+	IsLeftArm.Add(true);
+
+	HMDLocations.Add(HMDTransform.GetLocation());
+	HMDRotations.Add(HMDTransform.GetRotation());
+	ControllerLocations.Add(RightControllerTransform.GetLocation());
+	ControllerRotations.Add(RightControllerTransform.GetRotation());
+	IsLeftArm.Add(false);
+
+	return LeftIndex;
+}
+
+void ArmSolver::SolveArm(const FTransform & HMDTransform, const FTransform & ControllerTransform, bool bLeftArm, FArmSolverResult & OutResult) const
+{
+	SolveArm_Internal(HMDTransform.GetLocation(), HMDTransform.GetRotation(), ControllerTransform.GetLocation(), ControllerTransform.GetRotation(), bLeftArm, OutResult);
+}
+
+void ArmSolver::SolveBatch(FArmSolverBatch & Batch, bool bUseParallelFor) const
+{
+	CSV_SCOPED_TIMING_STAT(VRExpansion, ArmSolverBatch);
+
+	const int32 NumArms = Batch.Num();
+	check(Batch.HMDRotations.Num() == NumArms && Batch.ControllerLocations.Num() == NumArms && Batch.ControllerRotations.Num() == NumArms && Batch.IsLeftArm.Num() == NumArms);
+
+	Batch.ElbowLocations.SetNumUninitialized(NumArms);
+	Batch.WristLocations.SetNumUninitialized(NumArms);
+	Batch.UpperArmRotations.SetNumUninitialized(NumArms);
+	Batch.LowerArmRotations.SetNumUninitialized(NumArms);
+	Batch.HandRotations.SetNumUninitialized(NumArms);
+
+	// Each arm only writes its own slot so the chunks can run on any thread
+	auto SolveIndex = [this, &Batch](int32 Index)
+	{
+		FArmSolverResult Result;
+		SolveArm_Internal(Batch.HMDLocations[Index], Batch.HMDRotations[Index], Batch.ControllerLocations[Index], Batch.ControllerRotations[Index], Batch.IsLeftArm[Index], Result);
+
+		Batch.ElbowLocations[Index] = Result.ElbowLocation;
+		Batch.WristLocations[Index] = Result.WristLocation;
+		Batch.UpperArmRotations[Index] = Result.UpperArmRotation;
+		Batch.LowerArmRotations[Index] = Result.LowerArmRotation;
+		Batch.HandRotations[Index] = Result.HandRotation;
+	};
+
+	if (bUseParallelFor)
+	{
+		ParallelFor(NumArms, SolveIndex);
+	}
+	else
+	{
+		for (int32 i = 0; i < NumArms; ++i)
+			SolveIndex(i);
+	}
+
+	CSV_CUSTOM_STAT(VRExpansion, ArmSolverArms, NumArms, ECsvCustomStatOp::Accumulate);
+}
+
+float ArmSolver::GetElbowTargetAngle(const FVector & LocalHandPosNormalized, bool bLeftArm) const
+{
+	if (!calcElbowAngle)
+		return offsetAngle;
+
+	// Unreal is X forward, Y right, Z up
+	const float Forward = LocalHandPosNormalized.X;
+	const float Right = LocalHandPosNormalized.Y;
+	const float Up = LocalHandPosNormalized.Z;
+
+	// Angle from the height
+	float Angle = yWeight * Up + offsetAngle;
+
+	// Angle from the forward distance
+	if (Up > zBorderY)
+		Angle += zWeightTop * (FMath::Max(zDistanceStart - Forward, 0.f) * FMath::Max(Up, 0.f));
+	else
+		Angle += zWeightBottom * (FMath::Max(zDistanceStart - Forward, 0.f) * FMath::Max(-Up, 0.f));
+
+	// Angle from reaching across the body
+	Angle += xWeight * FMath::Max(Right * (bLeftArm ? 1.0f : -1.0f) + xDistanceStart, 0.f);
+
+	if (clampElbowAngle)
+	{
+		if (softClampElbowAngle)
+		{
+			// Eases into minAngle instead of stopping on it, same slope as the unclamped angle where it starts
+			if (softClampRange <= 0.f)
+			{
+				Angle = FMath::Max(Angle, minAngle);
+			}
+			else if (Angle < minAngle + softClampRange)
+			{
+				float a = minAngle + softClampRange - Angle;
+				Angle = minAngle + softClampRange * FMath::Exp(-a / softClampRange);
+			}
+
+			Angle = FMath::Min(Angle, maxAngle);
+		}
+		else
+		{
+			Angle = FMath::Clamp(Angle, minAngle, maxAngle);
+		}
+	}
+
+	return Angle;
+}
+
+void ArmSolver::SolveArm_Internal(const FVector & HMDLocation, const FQuat & HMDRotation, const FVector & ControllerLocation, const FQuat & ControllerRotation, bool bLeftArm, FArmSolverResult & OutResult) const
+{
+	// Shoulders follow the HMD yaw only
+	const FQuat BodyRotation(FVector::UpVector, FMath::DegreesToRadians(HMDRotation.Rotator().Yaw));
+	const FVector BodyForward = BodyRotation.GetForwardVector();
+	const FVector BodyRight = BodyRotation.GetRightVector();
+
+	const FVector ShoulderCenter = HMDLocation + BodyRotation.RotateVector(headToShoulderCenter);
+	const FVector Shoulder = ShoulderCenter + BodyRight * (shoulderWidth * (bLeftArm ? -0.5f : 0.5f));
+
+	const float ArmLength = upperArmLength + lowerArmLength;
+	const float MinReach = FMath::Abs(upperArmLength - lowerArmLength) + KINDA_SMALL_NUMBER;
+	const float MaxReach = ArmLength * 0.999f;
+
+	FVector ToController = ControllerLocation - Shoulder;
+	float Distance = ToController.Size();
+	FVector ArmDir = Distance > KINDA_SMALL_NUMBER ? ToController / Distance : BodyForward;
+
+	OutResult.bAtReachLimit = Distance > MaxReach;
+	Distance = FMath::Clamp(Distance, MinReach, MaxReach);
+
+	const FVector Wrist = Shoulder + ArmDir * Distance;
+
+	// Elbow angle from where the hand is relative to the shoulder
+	const FVector LocalHandPosNormalized = BodyRotation.UnrotateVector(Wrist - Shoulder) / ArmLength;
+	const float ElbowAngle = GetElbowTargetAngle(LocalHandPosNormalized, bLeftArm);
+
+	// Rotate a straight up pole around the arm axis, positive angles swing away from the body
+	FVector PoleBase = FVector::VectorPlaneProject(FVector::UpVector, ArmDir);
+	if (!PoleBase.Normalize())
+	{
+		PoleBase = FVector::VectorPlaneProject(-BodyForward, ArmDir).GetSafeNormal();
+	}
+
+	const FVector Pole = PoleBase.RotateAngleAxis(bLeftArm ? ElbowAngle : -ElbowAngle, ArmDir);
+
+	// Law of cosines for how far along the arm axis the elbow sits
+	const float AlongAxis = (FMath::Square(upperArmLength) - FMath::Square(lowerArmLength) + FMath::Square(Distance)) / (2.f * Distance);
+	const float FromAxis = FMath::Sqrt(FMath::Max(FMath::Square(upperArmLength) - FMath::Square(AlongAxis), 0.f));
+
+	const FVector Elbow = Shoulder + ArmDir * AlongAxis + Pole * FromAxis;
+
+	OutResult.ShoulderLocation = Shoulder;
+	OutResult.ElbowLocation = Elbow;
+	OutResult.WristLocation = Wrist;
+	OutResult.UpperArmRotation = FRotationMatrix::MakeFromXZ(Elbow - Shoulder, Pole).ToQuat();
+	OutResult.LowerArmRotation = FRotationMatrix::MakeFromXZ(Wrist - Elbow, Pole).ToQuat();
+	OutResult.HandRotation = ControllerRotation;
+	OutResult.ElbowAngle = ElbowAngle;
+}
@@ -2,6 +2,7 @@
 
 #include "GripMotionControllerComponent.h"
 #include "IHeadMountedDisplay.h"
+#include "VRExpansionFunctionLibrary.h"
 //#include "DestructibleComponent.h" 4.18 moved apex destruct to a plugin
 #include "Misc/ScopeLock.h"
 #include "Net/UnrealNetwork.h"
@@ -18,6 +19,7 @@
 #include "DrawDebugHelpers.h"
 #include "TimerManager.h"
 #include "VRBaseCharacter.h"
+#include "Interactibles/VRInteractibleFunctionLibrary.h"
 
 #include "GripScripts/GS_Default.h"
 
@@ -105,6 +107,10 @@ UGripMotionControllerComponent::UGripMotionControllerComponent(const FObjectInit
 
 	DefaultGripScript = nullptr;
 	DefaultGripScriptClass = UGS_Default::StaticClass();
+
+	bSampleVelocityHistory = true;
+	VelocityHistoryWindow = 0.1f;
+	VelocityHistoryTime = 0.0;
 }
 
 //=============================================================================
@@ -220,6 +226,8 @@ void UGripMotionControllerComponent::OnUnregister()
 
 	ObjectsWaitingForSocketUpdate.Empty();
 
+	UVRInteractibleFunctionLibrary::Interactible_UnregisterHand(this);
+
 	Super::OnUnregister();
 }
 
@@ -243,6 +251,9 @@ void UGripMotionControllerComponent::BeginDestroy()
 void UGripMotionControllerComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// For interactibles that only wake with a hand nearby
+	UVRInteractibleFunctionLibrary::Interactible_RegisterHand(this);
 }
 
 void UGripMotionControllerComponent::CreateRenderState_Concurrent()
@@ -3261,6 +3272,8 @@ bool UGripMotionControllerComponent::GetGripWorldTransform(TArray<UVRGripScriptB
 void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 {
 	SCOPE_CYCLE_COUNTER(STAT_TickGrip);
+	CSV_SCOPED_TIMING_STAT(VRExpansion, TickGrip);
+	CSV_CUSTOM_STAT(VRExpansion, ActiveGrips, GrippedObjects.Num() + LocallyGrippedObjects.Num(), ECsvCustomStatOp::Accumulate);
 
 	// Debug test that we aren't floating physics handles
 	if (PhysicsGrips.Num() > (GrippedObjects.Num() + LocallyGrippedObjects.Num()))
@@ -3276,18 +3289,185 @@ void UGripMotionControllerComponent::TickGrip(float DeltaTime)
 	HandleGripArray(GrippedObjects, ParentTransform, DeltaTime, true);
 	HandleGripArray(LocallyGrippedObjects, ParentTransform, DeltaTime);
 
-	// Empty out the teleport flag
-	bIsPostTeleport = false;
-
 	// Save out the component velocity from this and last frame
 	if(!LastRelativePosition.GetTranslation().IsZero())
 		ComponentVelocity = (RelativeLocation - LastRelativePosition.GetTranslation()) / DeltaTime;
 
-	// #TODO:
-	// Relative angular velocity too?
-	// Maybe add some running averaging here to make it work across frames?
-	// Or Valves 30 frame high point average buffer
 	LastRelativePosition = this->GetRelativeTransform();
+
+	// Store the pose for the windowed velocity, a teleport would read as a huge velocity so start the history over
+	if (bSampleVelocityHistory && DeltaTime > 0.0f)
+	{
+		if (bIsPostTeleport)
+			VelocityHistory.Reset();
+
+		VelocityHistoryTime += DeltaTime;
+		VelocityHistory.AddSample(VelocityHistoryTime, GetComponentLocation(), GetComponentQuat());
+	}
+
+	// Empty out the teleport flag
+	bIsPostTeleport = false;
+}
+
+bool UGripMotionControllerComponent::GetLinearVelocityFromHistory(FVector& LinearVelocity)
+{
+	if (VelocityHistory.GetLinearVelocity(VelocityHistoryWindow, LinearVelocity))
+		return true;
+
+	// History is in world space, ComponentVelocity is a relative location delta so it has to be brought into world space to match
+	if (!VelocityHistory.GetLastFrameVelocity(LinearVelocity))
+	{
+		USceneComponent * Parent = GetAttachParent();
+		LinearVelocity = Parent ? Parent->GetComponentTransform().TransformVector(ComponentVelocity) : ComponentVelocity;
+	}
+
+	return false;
+}
+
+bool UGripMotionControllerComponent::GetAngularVelocityFromHistory(FVector& AngularVelocity)
+{
+	if (VelocityHistory.GetAngularVelocity(VelocityHistoryWindow, AngularVelocity))
+		return true;
+
+	AngularVelocity = FVector::ZeroVector;
+	return false;
+}
+
+void UGripMotionControllerComponent::ResetVelocityHistory()
+{
+	VelocityHistory.Reset();
+}
+
+void FVRVelocityHistory::AddSample(double TimeStamp, const FVector& Location, const FQuat& Rotation)
+{
+	FVelocitySample& Sample = Samples[NextIndex];
+	Sample.TimeStamp = TimeStamp;
+	Sample.Location = Location;
+	Sample.Rotation = Rotation;
+
+	NextIndex = (NextIndex + 1) % VR_VELOCITY_HISTORY_MAX_SAMPLES;
+	NumSamples = FMath::Min(NumSamples + 1, VR_VELOCITY_HISTORY_MAX_SAMPLES);
+}
+
+int32 FVRVelocityHistory::GetNumSamplesInWindow(float TimeWindow) const
+{
+	if (NumSamples < 1)
+		return 0;
+
+	const double NewestTime = GetSampleByAge(0).TimeStamp;
+
+	int32 Count = 1;
+	while (Count < NumSamples && (NewestTime - GetSampleByAge(Count).TimeStamp) <= TimeWindow)
+	{
+		++Count;
+	}
+
+	return Count;
+}
+
+bool FVRVelocityHistory::GetLinearVelocity(float TimeWindow, FVector& OutVelocity) const
+{
+	const int32 Count = GetNumSamplesInWindow(TimeWindow);
+	if (Count < 2)
+		return false;
+
+	// Times are relative to the newest sample to keep the precision in float range
+	const double NewestTime = GetSampleByAge(0).TimeStamp;
+
+	float MeanTime = 0.0f;
+	FVector MeanLocation = FVector::ZeroVector;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVelocitySample& Sample = GetSampleByAge(i);
+		MeanTime += (float)(Sample.TimeStamp - NewestTime);
+		MeanLocation += Sample.Location;
+	}
+
+	MeanTime /= Count;
+	MeanLocation /= Count;
+
+	// Slope of the least squares fit of location over time
+	float TimeVariance = 0.0f;
+	FVector Covariance = FVector::ZeroVector;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVelocitySample& Sample = GetSampleByAge(i);
+		const float TimeDelta = (float)(Sample.TimeStamp - NewestTime) - MeanTime;
+		TimeVariance += TimeDelta * TimeDelta;
+		Covariance += (Sample.Location - MeanLocation) * TimeDelta;
+	}
+
+	if (TimeVariance <= SMALL_NUMBER)
+		return false;
+
+	OutVelocity = Covariance / TimeVariance;
+	return true;
+}
+
+bool FVRVelocityHistory::GetLastFrameVelocity(FVector& OutVelocity) const
+{
+	if (NumSamples < 2)
+		return false;
+
+	const FVelocitySample& Newest = GetSampleByAge(0);
+	const FVelocitySample& Previous = GetSampleByAge(1);
+
+	const float TimeDelta = (float)(Newest.TimeStamp - Previous.TimeStamp);
+	if (TimeDelta <= SMALL_NUMBER)
+		return false;
+
+	OutVelocity = (Newest.Location - Previous.Location) / TimeDelta;
+	return true;
+}
+
+bool FVRVelocityHistory::GetAngularVelocity(float TimeWindow, FVector& OutAngularVelocity) const
+{
+	const int32 Count = GetNumSamplesInWindow(TimeWindow);
+	if (Count < 2)
+		return false;
+
+	const FVelocitySample& Newest = GetSampleByAge(0);
+	const FQuat NewestInverse = Newest.Rotation.Inverse();
+
+	// Each rotation is expressed as a world space rotation vector (axis * angle) from the newest sample
+	// then fit the same way as the linear velocity, the window is short enough that this doesn't wrap
+	float MeanTime = 0.0f;
+	FVector MeanRotation = FVector::ZeroVector;
+	FVector RotationVectors[VR_VELOCITY_HISTORY_MAX_SAMPLES];
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVelocitySample& Sample = GetSampleByAge(i);
+
+		FQuat Delta = Sample.Rotation * NewestInverse;
+		if (Delta.W < 0.0f)
+			Delta = Delta * -1.0f; // Shortest path
+
+		FVector Axis;
+		float Angle;
+		Delta.ToAxisAndAngle(Axis, Angle);
+		RotationVectors[i] = Axis * Angle;
+
+		MeanTime += (float)(Sample.TimeStamp - Newest.TimeStamp);
+		MeanRotation += RotationVectors[i];
+	}
+
+	MeanTime /= Count;
+	MeanRotation /= Count;
+
+	float TimeVariance = 0.0f;
+	FVector Covariance = FVector::ZeroVector;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const float TimeDelta = (float)(GetSampleByAge(i).TimeStamp - Newest.TimeStamp) - MeanTime;
+		TimeVariance += TimeDelta * TimeDelta;
+		Covariance += (RotationVectors[i] - MeanRotation) * TimeDelta;
+	}
+
+	if (TimeVariance <= SMALL_NUMBER)
+		return false;
+
+	OutAngularVelocity = FMath::RadiansToDegrees(Covariance / TimeVariance);
+	return true;
 }
 
 void UGripMotionControllerComponent::HandleGripArray(TArray<FBPActorGripInformation> &GrippedObjectsArray, const FTransform & ParentTransform, float DeltaTime, bool bReplicatedArray)
@@ -4510,7 +4690,7 @@ bool UGripMotionControllerComponent::GripPollControllerState(FVector& Position,
 						{
 							FQuat curRot;
 							FVector curLoc;
-							if (GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, curRot, curLoc))
+							if (UVRExpansionFunctionLibrary::GetHMDPoseForFrame(curRot, curLoc))
 							{
 								curLoc.Z = 0;
 								LastLocationForLateUpdate = curLoc;
@@ -4564,7 +4744,7 @@ bool UGripMotionControllerComponent::GripPollControllerState(FVector& Position,
 			if (TrackingSys)
 			{
 				FQuat OrientationQuat = FQuat::Identity;
-				if (TrackingSys->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, OrientationQuat, Position))
+				if (UVRExpansionFunctionLibrary::GetHMDPoseForFrame(OrientationQuat, Position))
 				{
 					Orientation = OrientationQuat.Rotator();
 					return true;
@@ -135,7 +135,7 @@ bool UGS_GunTools::GetWorldTransform_Implementation
 				FQuat curRot = FQuat::Identity;
 				FVector curLoc = FVector::ZeroVector;
 
-				if (GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, curRot, curLoc))
+				if (UVRExpansionFunctionLibrary::GetHMDPoseForFrame(curRot, curLoc))
 				{
 					// Translate hmd offset by the gripping controllers parent component, this should be in the same space
 					FRotator PureYaw = UVRExpansionFunctionLibrary::GetHMDPureYaw_I(curRot.Rotator());
@@ -0,0 +1,129 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GripScripts/GS_MeleeTools.h"
+#include "VRGripInterface.h"
+#include "GripMotionControllerComponent.h"
+
+UGS_MeleeTools::UGS_MeleeTools(const FObjectInitializer& ObjectInitializer) :
+	Super(ObjectInitializer)
+{
+	bIsActive = true;
+
+	// Let the default script place the object, we only need the resulting transform
+	WorldTransformOverrideType = EGSTransformOverrideType::ModifiesWorldTransform;
+
+	bUseSweptHitDetection = true;
+	MaxSubstepAngle = 10.0f;
+	MaxSubsteps = 8;
+	MinimumImpactSpeed = 0.0f;
+}
+
+void UGS_MeleeTools::OnGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation)
+{
+	// First frame of the grip only records the pose
+	LastSweptTransforms.Remove(FVRMeleeSweepKey(GrippingController, GripInformation.GripID));
+}
+
+void UGS_MeleeTools::OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed)
+{
+	LastSweptTransforms.Remove(FVRMeleeSweepKey(ReleasingController, GripInformation.GripID));
+}
+
+bool UGS_MeleeTools::GetWorldTransform_Implementation
+(
+	UGripMotionControllerComponent* GrippingController,
+	float DeltaTime, FTransform & WorldTransform,
+	const FTransform &ParentTransform,
+	FBPActorGripInformation &Grip,
+	AActor * actor,
+	UPrimitiveComponent * root,
+	bool bRootHasInterface,
+	bool bActorHasInterface,
+	bool bIsForTeleport
+)
+{
+	if (!bUseSweptHitDetection || !GrippingController || !root)
+		return true;
+
+	const FVRMeleeSweepKey SweepKey(GrippingController, Grip.GripID);
+
+	// Teleports shouldn't sweep through everything in between
+	const FTransform * LastSweptTransform = LastSweptTransforms.Find(SweepKey);
+	if (LastSweptTransform && !bIsForTeleport && DeltaTime > 0.0f)
+	{
+		SweepMeleeCollision(GrippingController, root, actor, *LastSweptTransform, WorldTransform, DeltaTime);
+	}
+
+	LastSweptTransforms.Add(SweepKey, WorldTransform);
+	return true;
+}
+
+int32 UGS_MeleeTools::SweepMeleeCollision(UGripMotionControllerComponent * GrippingController, UPrimitiveComponent * root, AActor * actor, const FTransform & FromTransform, const FTransform & ToTransform, float DeltaTime)
+{
+	const FQuat FromRot = FromTransform.GetRotation();
+	const FQuat ToRot = ToTransform.GetRotation();
+	const float AngleDelta = FMath::RadiansToDegrees(FromRot.AngularDistance(ToRot));
+	const FVector LinearVelocity = (ToTransform.GetLocation() - FromTransform.GetLocation()) / DeltaTime;
+
+	// Not moving enough to bother
+	if (AngleDelta < KINDA_SMALL_NUMBER && LinearVelocity.SizeSquared() * FMath::Square(DeltaTime) < FMath::Square(0.01f))
+		return 0;
+
+	CSV_SCOPED_TIMING_STAT(VRExpansion, MeleeSweep);
+
+	// Angular velocity as axis * radians per second
+	FVector DeltaAxis;
+	float DeltaAngleRad;
+	(ToRot * FromRot.Inverse()).GetNormalized().ToAxisAndAngle(DeltaAxis, DeltaAngleRad);
+	const FVector AngularVelocity = DeltaAxis * (FMath::UnwindRadians(DeltaAngleRad) / DeltaTime);
+
+	// Sub step on the angle, the sweep itself can't rotate so fast swings need more steps
+	const int32 NumSubsteps = FMath::Clamp(FMath::CeilToInt(AngleDelta / FMath::Max(MaxSubstepAngle, 1.0f)), 1, FMath::Max(MaxSubsteps, 1));
+
+	FComponentQueryParams Params(NAME_None, GrippingController->GetOwner());
+	Params.AddIgnoredActor(actor);
+	Params.AddIgnoredActors(root->MoveIgnoreActors);
+
+	TArray<FHitResult> Hits;
+	TArray<UPrimitiveComponent*, TInlineAllocator<8>> HitComponents;
+
+	for (int32 Step = 0; Step < NumSubsteps; ++Step)
+	{
+		float StartAlpha = (float)Step / NumSubsteps;
+		float EndAlpha = (float)(Step + 1) / NumSubsteps;
+
+		FVector Start = FMath::Lerp(FromTransform.GetLocation(), ToTransform.GetLocation(), StartAlpha);
+		FVector End = FMath::Lerp(FromTransform.GetLocation(), ToTransform.GetLocation(), EndAlpha);
+		FQuat StepRot = FQuat::Slerp(FromRot, ToRot, (StartAlpha + EndAlpha) * 0.5f);
+
+		Hits.Reset();
+		if (!GrippingController->GetWorld()->ComponentSweepMulti(Hits, root, Start, End, StepRot, Params))
+			continue;
+
+		for (const FHitResult & Hit : Hits)
+		{
+			// Already in contact at the start of the step, not a new impact
+			if (Hit.bStartPenetrating || !Hit.bBlockingHit)
+				continue;
+
+			UPrimitiveComponent * HitComp = Hit.Component.Get();
+			if (HitComponents.Contains(HitComp))
+				continue;
+
+			HitComponents.Add(HitComp);
+
+			FVector StepPivot = FMath::Lerp(Start, End, Hit.Time);
+			FVector ImpactVelocity = LinearVelocity + (AngularVelocity ^ (Hit.ImpactPoint - StepPivot));
+			float ImpactSpeed = FMath::Abs(ImpactVelocity | Hit.ImpactNormal);
+
+			if (ImpactSpeed < MinimumImpactSpeed)
+				continue;
+
+			CSV_CUSTOM_STAT(VRExpansion, MeleeSweepHits, 1, ECsvCustomStatOp::Accumulate);
+			OnMeleeSweepHit.Broadcast(Hit, ImpactVelocity, ImpactSpeed);
+		}
+	}
+
+	CSV_CUSTOM_STAT(VRExpansion, MeleeSweeps, NumSubsteps, ECsvCustomStatOp::Accumulate);
+	return NumSubsteps;
+}
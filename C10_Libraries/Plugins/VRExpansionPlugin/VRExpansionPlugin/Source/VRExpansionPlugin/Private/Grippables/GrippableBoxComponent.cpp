@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Grippables/GrippableBoxComponent.h"
+#include "Grippables/GrippableCore.h"
 #include "Net/UnrealNetwork.h"
 
 //=============================================================================
@@ -64,15 +65,7 @@ void UGrippableBoxComponent::PreReplication(IRepChangedPropertyTracker & Changed
 bool UGrippableBoxComponent::ReplicateSubobjects(UActorChannel* Channel, class FOutBunch *Bunch, FReplicationFlags *RepFlags)
 {
 	bool WroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-
-	for (UVRGripScriptBase* Script : GripLogicScripts)
-	{
-		if (Script && !Script->IsPendingKill())
-		{
-			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
-		}
-	}
-
+	WroteSomething |= FVRGrippableCore::ReplicateGripScripts(GripLogicScripts, Channel, Bunch, RepFlags);
 	return WroteSomething;
 }
 
@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Grippables/GrippableCapsuleComponent.h"
+#include "Grippables/GrippableCore.h"
 #include "Net/UnrealNetwork.h"
 
   //=============================================================================
@@ -60,15 +61,7 @@ void UGrippableCapsuleComponent::PreReplication(IRepChangedPropertyTracker & Cha
 bool UGrippableCapsuleComponent::ReplicateSubobjects(UActorChannel* Channel, class FOutBunch *Bunch, FReplicationFlags *RepFlags)
 {
 	bool WroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-
-	for (UVRGripScriptBase* Script : GripLogicScripts)
-	{
-		if (Script && !Script->IsPendingKill())
-		{
-			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
-		}
-	}
-
+	WroteSomething |= FVRGrippableCore::ReplicateGripScripts(GripLogicScripts, Channel, Bunch, RepFlags);
 	return WroteSomething;
 }
 
@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grippables/GrippableCore.h"
+#include "GripScripts/VRGripScriptBase.h"
+#include "GripMotionControllerComponent.h"
+#include "GameFramework/Controller.h"
+#include "Engine/ActorChannel.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+
+bool FVRGrippableCore::ReplicateGripScripts(const TArray<UVRGripScriptBase *> & GripLogicScripts, UActorChannel* Channel, FOutBunch *Bunch, FReplicationFlags *RepFlags)
+{
+	if (!GripLogicScripts.Num())
+		return false;
+
+	bool WroteSomething = false;
+
+	for (UVRGripScriptBase* Script : GripLogicScripts)
+	{
+		if (Script && !Script->IsPendingKill())
+		{
+			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
+		}
+	}
+
+	return WroteSomething;
+}
+
+void FVRGrippableCore::SetHeldClientAuth(AActor * GrippableActor, FVRClientAuthReplicationData & ClientAuthData, UGripMotionControllerComponent * HoldingController, bool bIsHeld, bool bSkipAttachmentReplication)
+{
+	if (bIsHeld)
+	{
+		ClientAuthData.LastHoldingController = HoldingController;
+
+		if (ClientAuthData.bIsCurrentlyClientAuth)
+		{
+			IVRReplicationInterface::RemoveObjectFromReplicationManager(GrippableActor);
+			CeaseClientAuthThrow(ClientAuthData);
+		}
+	}
+	else if (ClientAuthData.bUseClientAuthThrowing && bSkipAttachmentReplication)
+	{
+		if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(GrippableActor->GetRootComponent()))
+		{
+			if (PrimComp->IsSimulatingPhysics())
+			{
+				IVRReplicationInterface::AddObjectToReplicationManager(ClientAuthData.UpdateRate, GrippableActor);
+				ClientAuthData.bIsCurrentlyClientAuth = true;
+
+				// Only grippables that are actually thrown pay for the throwing state
+				if (!ClientAuthData.ThrowingState.IsValid())
+					ClientAuthData.ThrowingState = MakeUnique<FVRClientAuthThrowingState>();
+
+				FVRClientAuthThrowingState & ThrowingState = *ClientAuthData.ThrowingState;
+				ThrowingState.bWaitingToCease = false;
+				ThrowingState.CeaseBlockingAtTime = 0.0f;
+
+				if (UWorld * World = GrippableActor->GetWorld())
+					ThrowingState.TimeAtInitialThrow = World->GetTimeSeconds();
+			}
+		}
+	}
+}
+
+bool FVRGrippableCore::PollClientAuthThrow(AActor * GrippableActor, FVRClientAuthReplicationData & ClientAuthData, bool bSkipAttachmentReplication, TFunctionRef<void(const FRepMovementVR &)> SendOwnRPC)
+{
+	if (!ClientAuthData.bIsCurrentlyClientAuth || !ClientAuthData.ThrowingState.IsValid())
+		return false;
+
+	UWorld *OurWorld = GrippableActor->GetWorld();
+	if (!OurWorld)
+		return false;
+
+	FVRClientAuthThrowingState & ThrowingState = *ClientAuthData.ThrowingState;
+	const float CurrentTime = OurWorld->GetTimeSeconds();
+
+	// We are done sending and are just waiting out the ping before letting server movement back in
+	if (ThrowingState.bWaitingToCease)
+	{
+		if (CurrentTime >= ThrowingState.CeaseBlockingAtTime)
+		{
+			CeaseClientAuthThrow(ClientAuthData);
+			return false;
+		}
+
+		return true;
+	}
+
+	if ((CurrentTime - ThrowingState.TimeAtInitialThrow) > 10.0f)
+	{
+		// Lets time out sending, its been 10 seconds since we threw the object and its likely that it is conflicting with some server
+		// Authed movement that is forcing it to keep momentum.
+		CeaseClientAuthThrow(ClientAuthData);
+		return false;
+	}
+
+	// Store current transform for resting check
+	FTransform CurTransform = GrippableActor->GetActorTransform();
+
+	if (!CurTransform.GetRotation().Equals(ThrowingState.LastActorTransform.GetRotation()) || !CurTransform.GetLocation().Equals(ThrowingState.LastActorTransform.GetLocation()))
+	{
+		ThrowingState.LastActorTransform = CurTransform;
+
+		if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(GrippableActor->GetRootComponent()))
+		{
+			// Need to clamp to a max time since start, to handle cases with conflicting collisions
+			if (PrimComp->IsSimulatingPhysics() && bSkipAttachmentReplication)
+			{
+				FRepMovementVR ClientAuthMovementRep;
+				if (ClientAuthMovementRep.GatherActorsMovement(GrippableActor))
+				{
+					// Batched with the rest of our owners throws if possible, otherwise send it ourselves
+					if (!IVRReplicationInterface::QueueClientAuthThrow(GrippableActor, ClientAuthMovementRep))
+						SendOwnRPC(ClientAuthMovementRep);
+
+					if (PrimComp->RigidBodyIsAwake())
+						return true;
+				}
+			}
+		}
+		else
+		{
+			return false;
+		}
+	}
+	else
+	{
+		// Difference is too small, lets end sending location
+		ThrowingState.LastActorTransform = FTransform::Identity;
+	}
+
+	AActor* TopOwner = GrippableActor->GetOwner();
+
+	if (TopOwner != nullptr)
+	{
+		AActor * tempOwner = TopOwner->GetOwner();
+
+		// I have an owner so search that for the top owner
+		while (tempOwner)
+		{
+			TopOwner = tempOwner;
+			tempOwner = TopOwner->GetOwner();
+		}
+
+		if (APlayerController* PlayerController = Cast<APlayerController>(TopOwner))
+		{
+			if (APlayerState* PlayerState = PlayerController->PlayerState)
+			{
+				// Keep blocking server movement for the ping time, we stay in the replication manager until then instead of running a timer
+				// Lets clamp the ping to a min / max value just in case
+				float clampedPing = FMath::Clamp(PlayerState->ExactPing, 0.0f, 1000.0f);
+				ThrowingState.CeaseBlockingAtTime = CurrentTime + clampedPing;
+				ThrowingState.bWaitingToCease = true;
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool FVRGrippableCore::IsClientAuthThrownBy(const FVRClientAuthReplicationData & ClientAuthData, bool bIsHeld, AController * SendingController)
+{
+	if (bIsHeld || !SendingController || !ClientAuthData.bUseClientAuthThrowing)
+		return false;
+
+	UGripMotionControllerComponent * ThrowingController = ClientAuthData.LastHoldingController.Get();
+	AActor * ThrowingOwner = ThrowingController ? ThrowingController->GetOwner() : nullptr;
+
+	return ThrowingOwner && ThrowingOwner->IsOwnedBy(SendingController);
+}
+
+void FVRGrippableCore::CeaseClientAuthThrow(FVRClientAuthReplicationData & ClientAuthData)
+{
+	ClientAuthData.bIsCurrentlyClientAuth = false;
+	ClientAuthData.ThrowingState.Reset();
+}
@@ -3,6 +3,7 @@
 #include "GrippablePhysicsReplication.h"
 #include "UObject/ObjectMacros.h"
 #include "UObject/Interface.h"
+#include "VRPlayerController.h"
 
 // I cannot dynamic cast without RTTI so I am using a static var as a declarative in case the user removed our custom replicator
 // We don't want our casts to cause issues.
@@ -55,4 +56,77 @@ bool IVRReplicationInterface::RemoveObjectFromReplicationManager(UObject * Objec
 	}
 
 	return false;
-}
\ No newline at end of file
+}
+
+bool IVRReplicationInterface::QueueClientAuthThrow(AActor * ThrownActor, const FRepMovementVR & NewMovement)
+{
+	if (!VRPhysicsReplicationStatics::bHasVRPhysicsReplication || !ThrownActor)
+		return false;
+
+	AActor * TopOwner = ThrownActor->GetOwner();
+	if (!TopOwner)
+		return false;
+
+	// Walk up to the owning controller
+	while (AActor * NextOwner = TopOwner->GetOwner())
+	{
+		TopOwner = NextOwner;
+	}
+
+	AVRPlayerController * OwningController = Cast<AVRPlayerController>(TopOwner);
+	if (!OwningController || !OwningController->bBatchClientAuthThrows)
+		return false;
+
+	if (UWorld * OurWorld = ThrownActor->GetWorld())
+	{
+		if (FPhysScene *  PhysicsScene = OurWorld->GetPhysicsScene())
+		{
+			FPhysicsReplicationVR * PhysRep = ((FPhysicsReplicationVR *)PhysicsScene->GetPhysicsReplication());
+			PhysRep->BucketContainer.PendingClientAuthThrows.FindOrAdd(OwningController).Emplace(ThrownActor, NewMovement);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FReplicationBucketContainer::FlushClientAuthThrows()
+{
+	for (auto Itr = PendingClientAuthThrows.CreateIterator(); Itr; ++Itr)
+	{
+		AVRPlayerController * OwningController = Cast<AVRPlayerController>(Itr.Key().Get());
+		if (!OwningController || OwningController->IsPendingKill())
+		{
+			Itr.RemoveCurrent();
+			continue;
+		}
+
+		BatchClientAuthThrows(Itr.Value(), [OwningController](const TArray<FVRClientAuthThrowRep> & Batch)
+		{
+			OwningController->Server_SendClientAuthThrows(Batch);
+		});
+
+		// Keep the allocation around for the next update
+		Itr.Value().Reset();
+	}
+}
+
+void FReplicationBucketContainer::BatchClientAuthThrows(const TArray<FVRClientAuthThrowRep> & PendingThrows, TFunctionRef<void(const TArray<FVRClientAuthThrowRep> &)> SendRPC)
+{
+	if (PendingThrows.Num() <= VR_MAX_CLIENT_AUTH_THROWS_PER_RPC)
+	{
+		if (PendingThrows.Num() > 0)
+			SendRPC(PendingThrows);
+
+		return;
+	}
+
+	// The server rejects oversized batches, split them up
+	TArray<FVRClientAuthThrowRep> Batch;
+	for (int32 Start = 0; Start < PendingThrows.Num(); Start += VR_MAX_CLIENT_AUTH_THROWS_PER_RPC)
+	{
+		Batch.Reset();
+		Batch.Append(PendingThrows.GetData() + Start, FMath::Min(VR_MAX_CLIENT_AUTH_THROWS_PER_RPC, PendingThrows.Num() - Start));
+		SendRPC(Batch);
+	}
+}
@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Grippables/GrippableSkeletalMeshActor.h"
+#include "Grippables/GrippableCore.h"
 #include "Net/UnrealNetwork.h"
 
 UOptionalRepSkeletalMeshComponent::UOptionalRepSkeletalMeshComponent(const FObjectInitializer& ObjectInitializer)
@@ -87,15 +88,7 @@ void AGrippableSkeletalMeshActor::PreReplication(IRepChangedPropertyTracker & Ch
 bool AGrippableSkeletalMeshActor::ReplicateSubobjects(UActorChannel* Channel, class FOutBunch *Bunch, FReplicationFlags *RepFlags)
 {
 	bool WroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-
-	for (UVRGripScriptBase* Script : GripLogicScripts)
-	{
-		if (Script && !Script->IsPendingKill())
-		{
-			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
-		}
-	}
-
+	WroteSomething |= FVRGrippableCore::ReplicateGripScripts(GripLogicScripts, Channel, Bunch, RepFlags);
 	return WroteSomething;
 }
 
@@ -216,36 +209,8 @@ void AGrippableSkeletalMeshActor::IsHeld_Implementation(UGripMotionControllerCom
 
 void AGrippableSkeletalMeshActor::SetHeld_Implementation(UGripMotionControllerComponent * HoldingController, bool bIsHeld)
 {
-	if (bIsHeld)
-	{
-		VRGripInterfaceSettings.HoldingController = HoldingController;
-
-		if (ClientAuthReplicationData.bIsCurrentlyClientAuth)
-		{
-			IVRReplicationInterface::RemoveObjectFromReplicationManager(this);
-			CeaseReplicationBlocking();
-		}
-	}
-	else
-	{
-		VRGripInterfaceSettings.HoldingController = nullptr;
-
-		if (ClientAuthReplicationData.bUseClientAuthThrowing && ShouldWeSkipAttachmentReplication())
-		{
-			if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(GetRootComponent()))
-			{
-				if (PrimComp->IsSimulatingPhysics())
-				{
-					IVRReplicationInterface::AddObjectToReplicationManager(ClientAuthReplicationData.UpdateRate, this);
-					ClientAuthReplicationData.bIsCurrentlyClientAuth = true;
-
-					if (UWorld * World = GetWorld())
-						ClientAuthReplicationData.TimeAtInitialThrow = World->GetTimeSeconds();
-				}
-			}
-		}
-	}
-
+	VRGripInterfaceSettings.HoldingController = bIsHeld ? HoldingController : nullptr;
+	FVRGrippableCore::SetHeldClientAuth(this, ClientAuthReplicationData, HoldingController, bIsHeld, ShouldWeSkipAttachmentReplication());
 	VRGripInterfaceSettings.bIsHeld = bIsHeld;
 }
 
@@ -262,92 +227,15 @@ bool AGrippableSkeletalMeshActor::GetGripScripts_Implementation(TArray<UVRGripSc
 
 bool AGrippableSkeletalMeshActor::PollReplicationEvent(float DeltaTime)
 {
-	if (!ClientAuthReplicationData.bIsCurrentlyClientAuth)
-		return false;
-
-	UWorld *OurWorld = GetWorld();
-	if (!OurWorld)
-		return false;
-
-	if ((OurWorld->GetTimeSeconds() - ClientAuthReplicationData.TimeAtInitialThrow) > 10.0f)
+	return FVRGrippableCore::PollClientAuthThrow(this, ClientAuthReplicationData, ShouldWeSkipAttachmentReplication(), [this](const FRepMovementVR & MovementRep)
 	{
-		// Lets time out sending, its been 10 seconds since we threw the object and its likely that it is conflicting with some server
-		// Authed movement that is forcing it to keep momentum.
-		return false;
-	}
-
-	// Store current transform for resting check
-	FTransform CurTransform = this->GetActorTransform();
-
-	if (!CurTransform.GetRotation().Equals(ClientAuthReplicationData.LastActorTransform.GetRotation()) || !CurTransform.GetLocation().Equals(ClientAuthReplicationData.LastActorTransform.GetLocation()))
-	{
-		ClientAuthReplicationData.LastActorTransform = CurTransform;
-
-		if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(RootComponent))
-		{
-			// Need to clamp to a max time since start, to handle cases with conflicting collisions
-			if (PrimComp->IsSimulatingPhysics() && ShouldWeSkipAttachmentReplication())
-			{
-				FRepMovementVR ClientAuthMovementRep;
-				if (ClientAuthMovementRep.GatherActorsMovement(this))
-				{
-					Server_GetClientAuthRepliction(ClientAuthMovementRep);
-
-					if (PrimComp->RigidBodyIsAwake())
-						return true;
-				}
-			}
-		}
-		else
-		{
-			return false;
-		}
-	}
-	else
-	{
-		// Difference is too small, lets end sending location
-		ClientAuthReplicationData.LastActorTransform = FTransform::Identity;
-	}
-
-	AActor* TopOwner = GetOwner();
-
-	if (TopOwner != nullptr)
-	{
-		AActor * tempOwner = TopOwner->GetOwner();
-
-		// I have an owner so search that for the top owner
-		while (tempOwner)
-		{
-			TopOwner = tempOwner;
-			tempOwner = TopOwner->GetOwner();
-		}
-
-		if (APlayerController* PlayerController = Cast<APlayerController>(TopOwner))
-		{
-			if (APlayerState* PlayerState = PlayerController->PlayerState)
-			{
-				if (ClientAuthReplicationData.ResetReplicationHandle.IsValid())
-				{
-					OurWorld->GetTimerManager().ClearTimer(ClientAuthReplicationData.ResetReplicationHandle);
-				}
-
-				// Lets clamp the ping to a min / max value just in case
-				float clampedPing = FMath::Clamp(PlayerState->ExactPing, 0.0f, 1000.0f);
-				OurWorld->GetTimerManager().SetTimer(ClientAuthReplicationData.ResetReplicationHandle, this, &AGrippableSkeletalMeshActor::CeaseReplicationBlocking, clampedPing, false);
-			}
-		}
-	}
-
-	return false;
+		Server_GetClientAuthRepliction(MovementRep);
+	});
 }
 
 void AGrippableSkeletalMeshActor::CeaseReplicationBlocking()
 {
-	ClientAuthReplicationData.bIsCurrentlyClientAuth = false;
-	if (UWorld * OurWorld = GetWorld())
-	{
-		OurWorld->GetTimerManager().ClearTimer(ClientAuthReplicationData.ResetReplicationHandle);
-	}
+	FVRGrippableCore::CeaseClientAuthThrow(ClientAuthReplicationData);
 }
 
 void AGrippableSkeletalMeshActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -373,11 +261,21 @@ bool AGrippableSkeletalMeshActor::Server_GetClientAuthRepliction_Validate(const
 }
 
 void AGrippableSkeletalMeshActor::Server_GetClientAuthRepliction_Implementation(const FRepMovementVR & newMovement)
+{
+	ApplyClientAuthReplication(newMovement);
+}
+
+void AGrippableSkeletalMeshActor::ApplyClientAuthReplication(const FRepMovementVR & newMovement)
 {
 	newMovement.CopyTo(ReplicatedMovement);
 	OnRep_ReplicatedMovement();
 }
 
+bool AGrippableSkeletalMeshActor::IsClientAuthThrownBy(AController * SendingController) const
+{
+	return FVRGrippableCore::IsClientAuthThrownBy(ClientAuthReplicationData, VRGripInterfaceSettings.bIsHeld, SendingController);
+}
+
 void AGrippableSkeletalMeshActor::OnRep_AttachmentReplication()
 {
 	if (bAllowIgnoringAttachOnOwner && ShouldWeSkipAttachmentReplication())
@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "Grippables/GrippableStaticMeshActor.h"
+#include "Grippables/GrippableCore.h"
 #include "Net/UnrealNetwork.h"
 
 // #TODO: Pull request this? This macro could be very useful
@@ -109,15 +110,7 @@ void AGrippableStaticMeshActor::PreReplication(IRepChangedPropertyTracker & Chan
 bool AGrippableStaticMeshActor::ReplicateSubobjects(UActorChannel* Channel, class FOutBunch *Bunch, FReplicationFlags *RepFlags)
 {
 	bool WroteSomething = Super::ReplicateSubobjects(Channel, Bunch, RepFlags);
-
-	for (UVRGripScriptBase* Script : GripLogicScripts)
-	{
-		if (Script && !Script->IsPendingKill())
-		{
-			WroteSomething |= Channel->ReplicateSubobject(Script, *Bunch, *RepFlags);
-		}
-	}
-
+	WroteSomething |= FVRGrippableCore::ReplicateGripScripts(GripLogicScripts, Channel, Bunch, RepFlags);
 	return WroteSomething;
 }
 
@@ -233,36 +226,8 @@ void AGrippableStaticMeshActor::IsHeld_Implementation(UGripMotionControllerCompo
 
 void AGrippableStaticMeshActor::SetHeld_Implementation(UGripMotionControllerComponent * HoldingController, bool bIsHeld)
 {
-	if (bIsHeld)
-	{
-		VRGripInterfaceSettings.HoldingController = HoldingController;
-		
-		if (ClientAuthReplicationData.bIsCurrentlyClientAuth)
-		{
-			IVRReplicationInterface::RemoveObjectFromReplicationManager(this);
-			CeaseReplicationBlocking();
-		}
-	}
-	else
-	{
-		VRGripInterfaceSettings.HoldingController = nullptr;
-
-		if (ClientAuthReplicationData.bUseClientAuthThrowing && ShouldWeSkipAttachmentReplication())
-		{
-			if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(GetRootComponent()))
-			{
-				if (PrimComp->IsSimulatingPhysics())
-				{
-					IVRReplicationInterface::AddObjectToReplicationManager(ClientAuthReplicationData.UpdateRate, this);
-					ClientAuthReplicationData.bIsCurrentlyClientAuth = true;
-
-					if (UWorld * World = GetWorld())
-						ClientAuthReplicationData.TimeAtInitialThrow = World->GetTimeSeconds();
-				}
-			}
-		}
-	}
-
+	VRGripInterfaceSettings.HoldingController = bIsHeld ? HoldingController : nullptr;
+	FVRGrippableCore::SetHeldClientAuth(this, ClientAuthReplicationData, HoldingController, bIsHeld, ShouldWeSkipAttachmentReplication());
 	VRGripInterfaceSettings.bIsHeld = bIsHeld;
 }
 
@@ -279,92 +244,15 @@ bool AGrippableStaticMeshActor::GetGripScripts_Implementation(TArray<UVRGripScri
 
 bool AGrippableStaticMeshActor::PollReplicationEvent(float DeltaTime)
 {
-	if (!ClientAuthReplicationData.bIsCurrentlyClientAuth)
-		return false;
-
-	UWorld *OurWorld = GetWorld();
-	if (!OurWorld)
-		return false;
-
-	if ((OurWorld->GetTimeSeconds() - ClientAuthReplicationData.TimeAtInitialThrow) > 10.0f)
-	{
-		// Lets time out sending, its been 10 seconds since we threw the object and its likely that it is conflicting with some server
-		// Authed movement that is forcing it to keep momentum.
-		return false;
-	}
-
-	// Store current transform for resting check
-	FTransform CurTransform = this->GetActorTransform();
-
-	if (!CurTransform.GetRotation().Equals(ClientAuthReplicationData.LastActorTransform.GetRotation()) || !CurTransform.GetLocation().Equals(ClientAuthReplicationData.LastActorTransform.GetLocation()))
-	{
-		ClientAuthReplicationData.LastActorTransform = CurTransform;
-
-		if (UPrimitiveComponent * PrimComp = Cast<UPrimitiveComponent>(RootComponent))
-		{
-			// Need to clamp to a max time since start, to handle cases with conflicting collisions
-			if (PrimComp->IsSimulatingPhysics() && ShouldWeSkipAttachmentReplication())
-			{
-				FRepMovementVR ClientAuthMovementRep;
-				if (ClientAuthMovementRep.GatherActorsMovement(this))
-				{
-					Server_GetClientAuthRepliction(ClientAuthMovementRep);
-
-					if (PrimComp->RigidBodyIsAwake())
-						return true;
-				}
-			}
-		}
-		else
-		{
-			return false;
-		}
-	}
-	else
-	{
-		// Difference is too small, lets end sending location
-		ClientAuthReplicationData.LastActorTransform = FTransform::Identity;
-	}
-
-	AActor* TopOwner = GetOwner();
-
-	if (TopOwner != nullptr)
+	return FVRGrippableCore::PollClientAuthThrow(this, ClientAuthReplicationData, ShouldWeSkipAttachmentReplication(), [this](const FRepMovementVR & MovementRep)
 	{
-		AActor * tempOwner = TopOwner->GetOwner();
-
-		// I have an owner so search that for the top owner
-		while (tempOwner)
-		{
-			TopOwner = tempOwner;
-			tempOwner = TopOwner->GetOwner();
-		}
-
-		if (APlayerController* PlayerController = Cast<APlayerController>(TopOwner))
-		{
-			if (APlayerState* PlayerState = PlayerController->PlayerState)
-			{
-				if (ClientAuthReplicationData.ResetReplicationHandle.IsValid())
-				{
-					OurWorld->GetTimerManager().ClearTimer(ClientAuthReplicationData.ResetReplicationHandle);
-				}
-
-				// Lets clamp the ping to a min / max value just in case
-				float clampedPing = FMath::Clamp(PlayerState->ExactPing, 0.0f, 1000.0f);
-				OurWorld->GetTimerManager().SetTimer(ClientAuthReplicationData.ResetReplicationHandle, this, &AGrippableStaticMeshActor::CeaseReplicationBlocking, clampedPing, false);
-			}
-		}
-	}
-
-	return false;
+		Server_GetClientAuthRepliction(MovementRep);
+	});
 }
 
 void AGrippableStaticMeshActor::CeaseReplicationBlocking()
 {
-	ClientAuthReplicationData.bIsCurrentlyClientAuth = false;
-	if (UWorld * OurWorld = GetWorld())
-	{
-		OurWorld->GetTimerManager().ClearTimer(ClientAuthReplicationData.ResetReplicationHandle);
-	}
+	FVRGrippableCore::CeaseClientAuthThrow(ClientAuthReplicationData);
 }
 
 void AGrippableStaticMeshActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -390,11 +278,21 @@ bool AGrippableStaticMeshActor::Server_GetClientAuthRepliction_Validate(const FR
 }
 
 void AGrippableStaticMeshActor::Server_GetClientAuthRepliction_Implementation(const FRepMovementVR & newMovement)
+{
+	ApplyClientAuthReplication(newMovement);
+}
+
+void AGrippableStaticMeshActor::ApplyClientAuthReplication(const FRepMovementVR & newMovement)
 {
 	newMovement.CopyTo(ReplicatedMovement);
 	OnRep_ReplicatedMovement();
 }
 
+bool AGrippableStaticMeshActor::IsClientAuthThrownBy(AController * SendingController) const
+{
+	return FVRGrippableCore::IsClientAuthThrownBy(ClientAuthReplicationData, VRGripInterfaceSettings.bIsHeld, SendingController);
+}
+
 void AGrippableStaticMeshActor::OnRep_AttachmentReplication()
 {
 	if (bAllowIgnoringAttachOnOwner && ShouldWeSkipAttachmentReplication())
@@ -15,6 +15,7 @@ UVRButtonComponent::UVRButtonComponent(const FObjectInitializer& ObjectInitializ
 	DepressDistance = 8.0f;
 	ButtonEngageDepth = 8.0f;
 	DepressSpeed = 50.0f;
+	SettleTime = 0.0f;
 
 	ButtonAxis = EVRInteractibleAxis::Axis_Z;
 	ButtonType = EVRButtonType::Btn_Toggle_Return;
@@ -29,6 +30,8 @@ UVRButtonComponent::UVRButtonComponent(const FObjectInitializer& ObjectInitializ
 	InitialRelativeTransform = FTransform::Identity;
 
 	bReplicateMovement = false;
+	bReplicateQuantizedState = false;
+	QuantizedButtonDepth = MAX_uint16; // Resting position
 }
 
 //=============================================================================
@@ -42,6 +45,7 @@ void UVRButtonComponent::GetLifetimeReplicatedProps(TArray< class FLifetimePrope
 
 	DOREPLIFETIME(UVRButtonComponent, InitialRelativeTransform);
 	DOREPLIFETIME(UVRButtonComponent, bReplicateMovement);
+	DOREPLIFETIME_CONDITION(UVRButtonComponent, QuantizedButtonDepth, COND_Custom);
 	DOREPLIFETIME_CONDITION(UVRButtonComponent, bButtonState, COND_InitialOnly);
 }
 
@@ -52,9 +56,17 @@ void UVRButtonComponent::PreReplication(IRepChangedPropertyTracker & ChangedProp
 	// Replicate the levers initial transform if we are replicating movement
 	//DOREPLIFETIME_ACTIVE_OVERRIDE(UVRButtonComponent, InitialRelativeTransform, bReplicateMovement);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement);
+	// Send the packed depth in place of the relative transform if requested
+	bool bRepQuantizedState = bReplicateMovement && bReplicateQuantizedState;
+
+	if (bRepQuantizedState)
+		QuantizedButtonDepth = UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(GetAxisValue(InitialRelativeTransform.InverseTransformPosition(this->RelativeLocation)), -DepressDistance, 0.0f);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRButtonComponent, QuantizedButtonDepth, bRepQuantizedState);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement && !bRepQuantizedState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement && !bRepQuantizedState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement && !bRepQuantizedState);
 }
 
 void UVRButtonComponent::OnRegister()
@@ -83,6 +95,8 @@ void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 
 	if (LocalInteractingComponent.IsValid())
 	{
+		SettleTime = 0.0f;
+
 		// If button was set to inactive during use
 		if (!bIsEnabled)
 		{
@@ -91,6 +105,13 @@ void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 			return;
 		}
 
+		// No hand near anymore, whatever is still pressing is a prop so let the button return and sleep
+		if (!UVRInteractibleFunctionLibrary::Interactible_CanWakeFromOverlap(SleepSettings, this))
+		{
+			LocalInteractingComponent.Reset();
+			return;
+		}
+
 		FTransform OriginalBaseTransform = CalcNewComponentToWorld(InitialRelativeTransform);
 
 		float CheckDepth = FMath::Clamp(GetAxisValue(InitialLocation) - GetAxisValue(OriginalBaseTransform.InverseTransformPosition(LocalInteractingComponent->GetComponentLocation())), 0.0f, DepressDistance);
@@ -122,10 +143,23 @@ void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 	}
 	else
 	{
+		const FVector TargetRelativeLocation = GetTargetRelativeLocation();
+		bool bSettled = this->RelativeLocation.Equals(TargetRelativeLocation);
+
+		// Nudged buttons may never land exactly, let the sleep policy end the return
+		if (!bSettled && (UVRInteractibleFunctionLibrary::Interactible_IsWithinSettleTolerance(SleepSettings, FVector::Dist(this->RelativeLocation, TargetRelativeLocation)) ||
+			UVRInteractibleFunctionLibrary::Interactible_UpdateSettleTime(SleepSettings, DeltaTime, SettleTime)))
+		{
+			CSV_CUSTOM_STAT(VRExpansion, InteractibleSettleSleeps, 1, ECsvCustomStatOp::Accumulate);
+			this->SetRelativeLocation(TargetRelativeLocation, false);
+			bSettled = true;
+		}
+
 		// Std precision tolerance should be fine
-		if (this->RelativeLocation.Equals(GetTargetRelativeLocation()))
+		if (bSettled)
 		{
 			this->SetComponentTickEnabled(false);
+			SettleTime = 0.0f;
 
 			OnButtonEndInteraction.Broadcast(LocalLastInteractingActor.Get(), LocalLastInteractingComponent.Get());
 			ReceiveButtonEndInteraction(LocalLastInteractingActor.Get(), LocalLastInteractingComponent.Get());
@@ -134,7 +168,7 @@ void UVRButtonComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 			LocalLastInteractingComponent.Reset();
 		}
 		else
-			this->SetRelativeLocation(FMath::VInterpConstantTo(this->RelativeLocation, GetTargetRelativeLocation(), DeltaTime, DepressSpeed), false);
+			this->SetRelativeLocation(FMath::VInterpConstantTo(this->RelativeLocation, TargetRelativeLocation, DeltaTime, DepressSpeed), false);
 	}
 
 
@@ -257,7 +291,7 @@ void UVRButtonComponent::SetLastInteractingActor()
 void UVRButtonComponent::OnOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
 {
 	// Other Actor is the actor that triggered the event. Check that is not ourself.  
-	if (bIsEnabled && !LocalInteractingComponent.IsValid() && (bSkipOverlapFiltering || IsValidOverlap(OtherComp)))
+	if (bIsEnabled && !LocalInteractingComponent.IsValid() && (bSkipOverlapFiltering || IsValidOverlap(OtherComp)) && UVRInteractibleFunctionLibrary::Interactible_CanWakeFromOverlap(SleepSettings, this))
 	{
 		LocalInteractingComponent = OtherComp;
 
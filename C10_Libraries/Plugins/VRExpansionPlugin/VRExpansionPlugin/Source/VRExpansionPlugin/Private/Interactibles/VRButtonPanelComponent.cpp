@@ -0,0 +1,444 @@
+// Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
+
+#include "Interactibles/VRButtonPanelComponent.h"
+#include "GameFramework/Character.h"
+
+// Depth changes smaller than this while a button is held down are fingertip jitter, not worth re-sending the instances for
+#define VR_BUTTON_PANEL_DEPTH_TOLERANCE 0.01f
+
+  //=============================================================================
+UVRButtonPanelComponent::UVRButtonPanelComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	this->PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.bCanEverTick = true;
+
+	DepressDistance = 8.0f;
+	ButtonEngageDepth = 8.0f;
+	DepressSpeed = 50.0f;
+
+	ButtonAxis = EVRInteractibleAxis::Axis_Z;
+
+	MinTimeBetweenEngaging = 0.1f;
+
+	// The fingertips are probed manually, no need for per instance bodies
+	this->SetGenerateOverlapEvents(false);
+	this->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+	PanelBounds = FBox(ForceInit);
+	bHasActiveButtons = false;
+	bInstancesDirty = false;
+	NumRenderStateUpdates = 0;
+}
+
+//=============================================================================
+UVRButtonPanelComponent::~UVRButtonPanelComponent()
+{
+}
+
+void UVRButtonPanelComponent::BeginPlay()
+{
+	// Call the base class
+	Super::BeginPlay();
+
+	RebuildButtons();
+}
+
+#if WITH_EDITOR
+void UVRButtonPanelComponent::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	FName MemberPropertyName = PropertyChangedEvent.MemberProperty ? PropertyChangedEvent.MemberProperty->GetFName() : NAME_None;
+
+	if (MemberPropertyName == GET_MEMBER_NAME_CHECKED(UVRButtonPanelComponent, Buttons) ||
+		MemberPropertyName == GET_MEMBER_NAME_CHECKED(UVRButtonPanelComponent, ButtonAxis))
+	{
+		RebuildButtons();
+	}
+}
+#endif
+
+void UVRButtonPanelComponent::RebuildButtons()
+{
+	ClearInstances();
+
+	int32 NumButtons = Buttons.Num();
+	ButtonStates.Reset(NumButtons);
+	ButtonStates.AddDefaulted(NumButtons);
+
+	BoundsMinX.SetNumUninitialized(NumButtons);
+	BoundsMinY.SetNumUninitialized(NumButtons);
+	BoundsMinZ.SetNumUninitialized(NumButtons);
+	BoundsMaxX.SetNumUninitialized(NumButtons);
+	BoundsMaxY.SetNumUninitialized(NumButtons);
+	BoundsMaxZ.SetNumUninitialized(NumButtons);
+	PanelBounds = FBox(ForceInit);
+
+	for (int32 i = 0; i < NumButtons; ++i)
+	{
+		const FVRPanelButton & Button = Buttons[i];
+		FPanelButtonState & State = ButtonStates[i];
+
+		State.InverseRelativeTransform = Button.RelativeTransform.Inverse();
+
+		FBox ButtonBounds = FBox(-Button.BoxExtent, Button.BoxExtent).TransformBy(Button.RelativeTransform);
+		BoundsMinX[i] = ButtonBounds.Min.X;
+		BoundsMinY[i] = ButtonBounds.Min.Y;
+		BoundsMinZ[i] = ButtonBounds.Min.Z;
+		BoundsMaxX[i] = ButtonBounds.Max.X;
+		BoundsMaxY[i] = ButtonBounds.Max.Y;
+		BoundsMaxZ[i] = ButtonBounds.Max.Z;
+		PanelBounds += ButtonBounds;
+
+		AddInstance(Button.RelativeTransform);
+
+		// Toggle stay buttons start in their held position if they are on
+		float RestingDepth = GetTargetDepth(i);
+		if (RestingDepth != 0.0f)
+			SetButtonDepth(i, RestingDepth);
+	}
+
+	bHasActiveButtons = false;
+	bInstancesDirty = false;
+	MarkRenderStateDirty();
+}
+
+void UVRButtonPanelComponent::RegisterFingertip(UPrimitiveComponent * FingertipComponent)
+{
+	if (!FingertipComponent)
+		return;
+
+	Fingertips.AddUnique(FingertipComponent);
+	this->SetComponentTickEnabled(true);
+}
+
+void UVRButtonPanelComponent::UnregisterFingertip(UPrimitiveComponent * FingertipComponent)
+{
+	Fingertips.Remove(FingertipComponent);
+}
+
+void UVRButtonPanelComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
+{
+	// Call supers tick (though I don't think any of the base classes to this actually implement it)
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	CSV_SCOPED_TIMING_STAT(VRExpansion, ButtonPanelProbe);
+
+	const float WorldTime = GetWorld()->GetTimeSeconds();
+	const int32 NumButtons = FMath::Min(ButtonStates.Num(), Buttons.Num());
+
+	// Gather the fingertips into panel space once, dropping any that were destroyed
+	FingertipLocations.Reset();
+	const FTransform & PanelTransform = this->GetComponentTransform();
+
+	for (int32 i = Fingertips.Num() - 1; i >= 0; --i)
+	{
+		if (!Fingertips[i].IsValid())
+			Fingertips.RemoveAtSwap(i, 1, false);
+	}
+
+	for (const TWeakObjectPtr<UPrimitiveComponent> & Fingertip : Fingertips)
+	{
+		FingertipLocations.Add(PanelTransform.InverseTransformPosition(Fingertip->GetComponentLocation()));
+	}
+
+	// Which fingertip is inside each button this frame, the one already pressing it takes priority
+	TArray<int32, TInlineAllocator<256>> TouchingFingertip;
+	TArray<FVector, TInlineAllocator<256>> TouchingLocation;
+	TouchingFingertip.Init(INDEX_NONE, NumButtons);
+	TouchingLocation.SetNumUninitialized(NumButtons);
+
+	int32 NumNarrowTests = 0;
+
+	for (int32 TipIndex = 0; TipIndex < FingertipLocations.Num(); ++TipIndex)
+	{
+		const FVector TipLoc = FingertipLocations[TipIndex];
+
+		if (!PanelBounds.IsInsideOrOn(TipLoc))
+			continue;
+
+		const float * RESTRICT MinX = BoundsMinX.GetData();
+		const float * RESTRICT MinY = BoundsMinY.GetData();
+		const float * RESTRICT MinZ = BoundsMinZ.GetData();
+		const float * RESTRICT MaxX = BoundsMaxX.GetData();
+		const float * RESTRICT MaxY = BoundsMaxY.GetData();
+		const float * RESTRICT MaxZ = BoundsMaxZ.GetData();
+
+		for (int32 i = 0; i < NumButtons; ++i)
+		{
+			// Broad phase against the panel space bounds, branch free so it stays vectorizable
+			if ((TipLoc.X >= MinX[i]) & (TipLoc.X <= MaxX[i]) & (TipLoc.Y >= MinY[i]) & (TipLoc.Y <= MaxY[i]) & (TipLoc.Z >= MinZ[i]) & (TipLoc.Z <= MaxZ[i]))
+			{
+				++NumNarrowTests;
+
+				FVector ButtonSpaceLoc = ButtonStates[i].InverseRelativeTransform.TransformPosition(TipLoc);
+				const FVector & Extent = Buttons[i].BoxExtent;
+
+				if (FMath::Abs(ButtonSpaceLoc.X) <= Extent.X && FMath::Abs(ButtonSpaceLoc.Y) <= Extent.Y && FMath::Abs(ButtonSpaceLoc.Z) <= Extent.Z)
+				{
+					if (TouchingFingertip[i] == INDEX_NONE || ButtonStates[i].InteractingComponent == Fingertips[TipIndex])
+					{
+						TouchingFingertip[i] = TipIndex;
+						TouchingLocation[i] = ButtonSpaceLoc;
+					}
+				}
+			}
+		}
+	}
+
+	CSV_CUSTOM_STAT(VRExpansion, ButtonPanelNarrowTests, NumNarrowTests, ECsvCustomStatOp::Accumulate);
+
+	// Nothing touched and nothing returning to rest
+	if (NumNarrowTests == 0 && !bHasActiveButtons)
+	{
+		// A snapped button state may still need to be sent
+		FlushInstanceUpdates();
+
+		if (Fingertips.Num() == 0)
+			this->SetComponentTickEnabled(false);
+
+		return;
+	}
+
+	bool bAnyActive = false;
+
+	for (int32 i = 0; i < NumButtons; ++i)
+	{
+		FPanelButtonState & State = ButtonStates[i];
+		FVRPanelButton & Button = Buttons[i];
+
+		if (!State.bIsActive && TouchingFingertip[i] == INDEX_NONE)
+			continue;
+
+		// If button was set to inactive during use, or the fingertip left its volume
+		if (State.InteractingComponent.IsValid() && (!Button.bIsEnabled || TouchingFingertip[i] == INDEX_NONE || Fingertips[TouchingFingertip[i]] != State.InteractingComponent))
+		{
+			State.InteractingComponent.Reset();
+		}
+
+		if (!State.InteractingComponent.IsValid() && TouchingFingertip[i] != INDEX_NONE && Button.bIsEnabled)
+		{
+			BeginButtonInteraction(i, TouchingFingertip[i], TouchingLocation[i]);
+		}
+
+		if (State.InteractingComponent.IsValid())
+		{
+			float CheckDepth = FMath::Clamp(State.InitialFingertipDepth - GetAxisValue(TouchingLocation[i]), 0.0f, DepressDistance);
+
+			if (CheckDepth > 0.0f)
+			{
+				float ClampMinDepth = 0.0f;
+
+				// If active and a toggled stay, then clamp min to the toggled stay location
+				if (Button.ButtonType == EVRButtonType::Btn_Toggle_Stay && Button.bButtonState)
+					ClampMinDepth = -(ButtonEngageDepth + (1.e-2f)); // + NOT_SO_KINDA_SMALL_NUMBER
+
+				float NewDepth = FMath::Clamp(State.InitialButtonDepth + (-CheckDepth), -DepressDistance, ClampMinDepth);
+
+				if (FMath::Abs(NewDepth - State.CurrentDepth) > VR_BUTTON_PANEL_DEPTH_TOLERANCE || NewDepth == -DepressDistance || NewDepth == ClampMinDepth)
+					SetButtonDepth(i, NewDepth);
+
+				if (Button.ButtonType == EVRButtonType::Btn_Toggle_Return || Button.ButtonType == EVRButtonType::Btn_Toggle_Stay)
+				{
+					if (!State.bToggledThisTouch && NewDepth <= (-ButtonEngageDepth) + KINDA_SMALL_NUMBER && (WorldTime - State.LastToggleTime) >= MinTimeBetweenEngaging)
+					{
+						State.LastToggleTime = WorldTime;
+						State.bToggledThisTouch = true;
+						ChangeButtonState(i, !Button.bButtonState, true);
+					}
+				}
+			}
+		}
+		else
+		{
+			float TargetDepth = GetTargetDepth(i);
+
+			// Std precision tolerance should be fine
+			if (FMath::IsNearlyEqual(State.CurrentDepth, TargetDepth))
+			{
+				State.bIsActive = false;
+
+				UPrimitiveComponent * LastComp = State.LastInteractingComponent.Get();
+				AActor * LastActor = GetInteractingActor(LastComp);
+				OnButtonEndInteraction.Broadcast(i, LastActor, LastComp);
+				ReceiveButtonEndInteraction(i, LastActor, LastComp);
+
+				State.LastInteractingComponent.Reset(); // Just reset it here so it only does it once
+			}
+			else
+				SetButtonDepth(i, FMath::FInterpConstantTo(State.CurrentDepth, TargetDepth, DeltaTime, DepressSpeed));
+		}
+
+		// Press buttons always get checked, both during press AND during lerping for if they are active or not.
+		if (Button.ButtonType == EVRButtonType::Btn_Press)
+		{
+			bool bCheckState = State.CurrentDepth <= (-ButtonEngageDepth) + KINDA_SMALL_NUMBER;
+			if (Button.bButtonState != bCheckState && (WorldTime - State.LastToggleTime) >= MinTimeBetweenEngaging)
+			{
+				State.LastToggleTime = WorldTime;
+				ChangeButtonState(i, bCheckState, true);
+			}
+		}
+
+		bAnyActive |= State.bIsActive;
+	}
+
+	bHasActiveButtons = bAnyActive;
+
+	FlushInstanceUpdates();
+
+	if (!bAnyActive && Fingertips.Num() == 0)
+		this->SetComponentTickEnabled(false);
+}
+
+void UVRButtonPanelComponent::BeginButtonInteraction(int32 ButtonIndex, int32 FingertipIndex, const FVector & ButtonSpaceLocation)
+{
+	FPanelButtonState & State = ButtonStates[ButtonIndex];
+
+	UPrimitiveComponent * InteractingComp = Fingertips[FingertipIndex].Get();
+
+	State.InteractingComponent = InteractingComp;
+	State.InitialFingertipDepth = GetAxisValue(ButtonSpaceLocation);
+	State.InitialButtonDepth = State.CurrentDepth;
+	State.bToggledThisTouch = false;
+	State.bIsActive = true;
+
+	if (InteractingComp != State.LastInteractingComponent.Get())
+	{
+		State.LastInteractingComponent = InteractingComp;
+		AActor * InteractingActor = GetInteractingActor(InteractingComp);
+		OnButtonBeginInteraction.Broadcast(ButtonIndex, InteractingActor, InteractingComp);
+		ReceiveButtonBeginInteraction(ButtonIndex, InteractingActor, InteractingComp);
+	}
+}
+
+void UVRButtonPanelComponent::SetButtonDepth(int32 ButtonIndex, float NewDepth)
+{
+	FPanelButtonState & State = ButtonStates[ButtonIndex];
+
+	if (State.CurrentDepth == NewDepth)
+		return;
+
+	State.CurrentDepth = NewDepth;
+
+	FTransform NewTransform = Buttons[ButtonIndex].RelativeTransform;
+	NewTransform.SetTranslation(NewTransform.TransformPosition(SetAxisValue(NewDepth)));
+
+	// Render state is marked dirty once per tick in FlushInstanceUpdates instead of per instance
+	const bool bWorldSpace = false;
+	const bool bMarkRenderStateDirty = false;
+	const bool bTeleport = true;
+	UpdateInstanceTransform(ButtonIndex, NewTransform, bWorldSpace, bMarkRenderStateDirty, bTeleport);
+	bInstancesDirty = true;
+}
+
+void UVRButtonPanelComponent::FlushInstanceUpdates()
+{
+	// Push all of the moved instances to the renderer at once
+	if (!bInstancesDirty)
+		return;
+
+	bInstancesDirty = false;
+	++NumRenderStateUpdates;
+	MarkRenderStateDirty();
+}
+
+float UVRButtonPanelComponent::GetTargetDepth(int32 ButtonIndex) const
+{
+	// If target is the half pressed
+	if (Buttons[ButtonIndex].ButtonType == EVRButtonType::Btn_Toggle_Stay && Buttons[ButtonIndex].bButtonState)
+	{
+		// 1.e-2f = MORE_KINDA_SMALL_NUMBER
+		return -(ButtonEngageDepth + (1.e-2f));
+	}
+
+	// Else return going all the way back
+	return 0.0f;
+}
+
+void UVRButtonPanelComponent::ChangeButtonState(int32 ButtonIndex, bool bNewButtonState, bool bCallButtonChangedEvent)
+{
+	Buttons[ButtonIndex].bButtonState = bNewButtonState;
+
+	if (bCallButtonChangedEvent)
+	{
+		UPrimitiveComponent * LastComp = ButtonStates[ButtonIndex].LastInteractingComponent.Get();
+		AActor * LastActor = GetInteractingActor(LastComp);
+		ReceiveButtonStateChanged(ButtonIndex, bNewButtonState, LastActor, LastComp);
+		OnButtonStateChanged.Broadcast(ButtonIndex, bNewButtonState, LastActor, LastComp);
+	}
+}
+
+void UVRButtonPanelComponent::SetButtonState(int32 ButtonIndex, bool bNewButtonState, bool bCallButtonChangedEvent, bool bSnapIntoPosition)
+{
+	if (!Buttons.IsValidIndex(ButtonIndex) || !ButtonStates.IsValidIndex(ButtonIndex))
+		return;
+
+	// No change
+	if (Buttons[ButtonIndex].bButtonState == bNewButtonState)
+		return;
+
+	FPanelButtonState & State = ButtonStates[ButtonIndex];
+	State.LastToggleTime = GetWorld()->GetTimeSeconds();
+
+	ChangeButtonState(ButtonIndex, bNewButtonState, bCallButtonChangedEvent);
+
+	// Only toggle stay buttons have a different resting position
+	if (Buttons[ButtonIndex].ButtonType == EVRButtonType::Btn_Toggle_Stay && !State.InteractingComponent.IsValid())
+	{
+		if (bSnapIntoPosition)
+		{
+			// Sent with the rest of this frames moves on the next tick, setting a whole bank at once only marks it dirty once
+			SetButtonDepth(ButtonIndex, GetTargetDepth(ButtonIndex));
+			this->SetComponentTickEnabled(true);
+		}
+		else
+		{
+			State.bIsActive = true; // This will trigger the lerp to resting position
+			bHasActiveButtons = true;
+			this->SetComponentTickEnabled(true);
+		}
+	}
+}
+
+bool UVRButtonPanelComponent::GetButtonState(int32 ButtonIndex) const
+{
+	return Buttons.IsValidIndex(ButtonIndex) ? Buttons[ButtonIndex].bButtonState : false;
+}
+
+bool UVRButtonPanelComponent::IsButtonInUse(int32 ButtonIndex) const
+{
+	return ButtonStates.IsValidIndex(ButtonIndex) && ButtonStates[ButtonIndex].InteractingComponent.IsValid();
+}
+
+AActor * UVRButtonPanelComponent::GetInteractingActor(UPrimitiveComponent * InteractingComponent) const
+{
+	if (!InteractingComponent)
+		return nullptr;
+
+	// Should return faster checking for owning character
+	AActor * OverlapOwner = InteractingComponent->GetOwner();
+	if (OverlapOwner && OverlapOwner->IsA(ACharacter::StaticClass()))
+		return OverlapOwner;
+
+	// Now check for if it is a grippable object and if it is currently held
+	UObject * GripObject = nullptr;
+	if (InteractingComponent->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+		GripObject = InteractingComponent;
+	else if (OverlapOwner && OverlapOwner->GetClass()->ImplementsInterface(UVRGripInterface::StaticClass()))
+		GripObject = OverlapOwner;
+
+	if (GripObject)
+	{
+		UGripMotionControllerComponent *Controller;
+		bool bIsHeld;
+		IVRGripInterface::Execute_IsHeld(GripObject, Controller, bIsHeld);
+
+		if (bIsHeld && Controller && Controller->GetOwner())
+			return Controller->GetOwner();
+	}
+
+	// Fall back to the owner, wasn't held and wasn't a character
+	return OverlapOwner;
+}
@@ -15,6 +15,8 @@ UVRDialComponent::UVRDialComponent(const FObjectInitializer& ObjectInitializer)
 
 	// Defaulting these true so that they work by default in networked environments
 	bReplicateMovement = true;
+	bReplicateQuantizedState = false;
+	QuantizedDialAngle = 0;
 
 	DialRotationAxis = EVRInteractibleAxis::Axis_Z;
 	InteractorRotationAxis = EVRInteractibleAxis::Axis_X;
@@ -23,6 +25,9 @@ UVRDialComponent::UVRDialComponent(const FObjectInitializer& ObjectInitializer)
 	SnapAngleThreshold = 0.0f;
 	SnapAngleIncrement = 45.0f;
 	LastSnapAngle = 0.0f;
+	DialRotationUpdateTolerance = 0.0f;
+	LastAppliedDialAngle = 0.0f;
+	NumDialTransformUpdates = 0;
 	RotationScaler = 1.0f;
 
 	ClockwiseMaximumDialAngle = 180.0f;
@@ -55,6 +60,7 @@ void UVRDialComponent::GetLifetimeReplicatedProps(TArray< class FLifetimePropert
 
 	DOREPLIFETIME(UVRDialComponent, bRepGameplayTags);
 	DOREPLIFETIME(UVRDialComponent, bReplicateMovement);
+	DOREPLIFETIME_CONDITION(UVRDialComponent, QuantizedDialAngle, COND_Custom);
 	DOREPLIFETIME_CONDITION(UVRDialComponent, GameplayTags, COND_Custom);
 }
 
@@ -65,9 +71,17 @@ void UVRDialComponent::PreReplication(IRepChangedPropertyTracker & ChangedProper
 	// Don't replicate if set to not do it
 	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRDialComponent, GameplayTags, bRepGameplayTags);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement);
+	// Send the packed angle in place of the relative transform if requested
+	bool bRepQuantizedState = bReplicateMovement && bReplicateQuantizedState;
+
+	if (bRepQuantizedState)
+		QuantizedDialAngle = UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(CurRotBackEnd, 0.0f, 360.0f);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRDialComponent, QuantizedDialAngle, bRepQuantizedState);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement && !bRepQuantizedState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement && !bRepQuantizedState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement && !bRepQuantizedState);
 }
 
 void UVRDialComponent::OnRegister()
@@ -170,10 +184,15 @@ void UVRDialComponent::OnGripRelease_Implementation(UGripMotionControllerCompone
 {
 	if (bDialUsesAngleSnap && FMath::Abs(FMath::Fmod(CurRotBackEnd, SnapAngleIncrement)) <= FMath::Min(SnapAngleIncrement, SnapAngleThreshold))
 	{
-		this->SetRelativeRotation((FTransform(UVRInteractibleFunctionLibrary::SetAxisValueRot(DialRotationAxis, FMath::GridSnap(CurRotBackEnd, SnapAngleIncrement), FRotator::ZeroRotator)) * InitialRelativeTransform).Rotator());		
 		CurRotBackEnd = FMath::GridSnap(CurRotBackEnd, SnapAngleIncrement);
+		UpdateDialRotation(CurRotBackEnd, true);
 		CurrentDialAngle = FRotator::ClampAxis(FMath::RoundToFloat(CurRotBackEnd));
 	}
+	else
+	{
+		// Flush anything held back by the update tolerance
+		UpdateDialRotation(CurRotBackEnd, true);
+	}
 
 	if (bLerpBackOnRelease)
 	{
@@ -330,10 +349,17 @@ bool UVRDialComponent::GetGripScripts_Implementation(TArray<UVRGripScriptBase*>
 void UVRDialComponent::SetDialAngle(float DialAngle, bool bCallEvents)
 {
 	CurRotBackEnd = DialAngle;
-	AddDialAngle(0.0f);
+
+	// Direct sets always land exactly
+	UpdateDialAngle(0.0f, false, true);
 }
 
 void UVRDialComponent::AddDialAngle(float DialAngleDelta, bool bCallEvents)
+{
+	UpdateDialAngle(DialAngleDelta, bCallEvents, false);
+}
+
+void UVRDialComponent::UpdateDialAngle(float DialAngleDelta, bool bCallEvents, bool bForceTransformUpdate)
 {
 	float MaxCheckValue = 360.0f - CClockwiseMaximumDialAngle;
 
@@ -368,7 +394,8 @@ void UVRDialComponent::AddDialAngle(float DialAngleDelta, bool bCallEvents)
 
 	if (bDialUsesAngleSnap && FMath::Abs(FMath::Fmod(CurRotBackEnd, SnapAngleIncrement)) <= FMath::Min(SnapAngleIncrement, SnapAngleThreshold))
 	{
-		this->SetRelativeRotation((FTransform(UVRInteractibleFunctionLibrary::SetAxisValueRot(DialRotationAxis, FMath::GridSnap(CurRotBackEnd, SnapAngleIncrement), FRotator::ZeroRotator)) * InitialRelativeTransform).Rotator());
+		// Snap angles are always applied so the dial visibly lands on them
+		UpdateDialRotation(FMath::GridSnap(CurRotBackEnd, SnapAngleIncrement), true);
 		CurrentDialAngle = FMath::RoundToFloat(FMath::GridSnap(CurRotBackEnd, SnapAngleIncrement));
 
 		if (bCallEvents && !FMath::IsNearlyEqual(LastSnapAngle, CurrentDialAngle))
@@ -381,15 +408,31 @@ void UVRDialComponent::AddDialAngle(float DialAngleDelta, bool bCallEvents)
 	}
 	else
 	{
-		this->SetRelativeRotation((FTransform(UVRInteractibleFunctionLibrary::SetAxisValueRot(DialRotationAxis, CurRotBackEnd, FRotator::ZeroRotator)) * InitialRelativeTransform).Rotator());
+		UpdateDialRotation(CurRotBackEnd, bForceTransformUpdate);
 		CurrentDialAngle = FMath::RoundToFloat(CurRotBackEnd);
 	}
 
 }
 
+void UVRDialComponent::UpdateDialRotation(float VisibleAngle, bool bForceUpdate)
+{
+	if (!bForceUpdate && DialRotationUpdateTolerance > 0.0f && FMath::Abs(FMath::FindDeltaAngleDegrees(LastAppliedDialAngle, VisibleAngle)) < DialRotationUpdateTolerance)
+		return;
+
+	// Nothing visible to do
+	if (LastAppliedDialAngle == VisibleAngle && DialRotationUpdateTolerance > 0.0f)
+		return;
+
+	CSV_CUSTOM_STAT(VRExpansion, DialTransformUpdates, 1, ECsvCustomStatOp::Accumulate);
+	++NumDialTransformUpdates;
+	this->SetRelativeRotation((FTransform(UVRInteractibleFunctionLibrary::SetAxisValueRot(DialRotationAxis, VisibleAngle, FRotator::ZeroRotator)) * InitialRelativeTransform).Rotator());
+	LastAppliedDialAngle = VisibleAngle;
+}
+
 void UVRDialComponent::ResetInitialDialLocation()
 {
 	// Get our initial relative transform to our parent (or not if un-parented).
 	InitialRelativeTransform = this->GetRelativeTransform();
 	CurRotBackEnd = 0.0f;
+	LastAppliedDialAngle = 0.0f;
 }
\ No newline at end of file
@@ -3,4 +3,43 @@
 #include "Engine/Engine.h"
 
 //General Log
-DEFINE_LOG_CATEGORY(VRInteractibleFunctionLibraryLog);
\ No newline at end of file
+DEFINE_LOG_CATEGORY(VRInteractibleFunctionLibraryLog);
+
+namespace VRInteractibleStatics
+{
+	// Only a handful of controllers per world, a flat list is cheaper than anything spatial
+	static TArray<TWeakObjectPtr<USceneComponent>> RegisteredHands;
+}
+
+void UVRInteractibleFunctionLibrary::Interactible_RegisterHand(USceneComponent * Hand)
+{
+	if (Hand)
+		VRInteractibleStatics::RegisteredHands.AddUnique(Hand);
+}
+
+void UVRInteractibleFunctionLibrary::Interactible_UnregisterHand(USceneComponent * Hand)
+{
+	VRInteractibleStatics::RegisteredHands.RemoveAll([Hand](const TWeakObjectPtr<USceneComponent> & RegisteredHand)
+	{
+		return !RegisteredHand.IsValid() || RegisteredHand.Get() == Hand;
+	});
+}
+
+bool UVRInteractibleFunctionLibrary::Interactible_IsHandWithinRange(const USceneComponent * Interactible, float Range)
+{
+	if (!Interactible)
+		return false;
+
+	const UWorld * World = Interactible->GetWorld();
+	const FVector Location = Interactible->GetComponentLocation();
+	const float RangeSq = FMath::Square(Range);
+
+	for (const TWeakObjectPtr<USceneComponent> & Hand : VRInteractibleStatics::RegisteredHands)
+	{
+		// PIE worlds share the list
+		if (Hand.IsValid() && Hand->GetWorld() == World && FVector::DistSquared(Hand->GetComponentLocation(), Location) <= RangeSq)
+			return true;
+	}
+
+	return false;
+}
@@ -15,6 +15,8 @@ UVRLeverComponent::UVRLeverComponent(const FObjectInitializer& ObjectInitializer
 
 	// Defaulting these true so that they work by default in networked environments
 	bReplicateMovement = true;
+	bReplicateQuantizedState = false;
+	QuantizedLeverAngle = 32768; // 0 degrees in the -180 to 180 range
 
 	MovementReplicationSetting = EGripMovementReplicationSettings::ForceClientSideMovement;
 	BreakDistance = 100.0f;
@@ -52,6 +54,7 @@ UVRLeverComponent::UVRLeverComponent(const FObjectInitializer& ObjectInitializer
 	InitialGripRot = 0.0f;
 	qRotAtGrab = FQuat::Identity;
 	bIsLerping = false;
+	SettleTime = 0.0f;
 	bUngripAtTargetRotation = false;
 	bDenyGripping = false;
 
@@ -75,6 +78,7 @@ void UVRLeverComponent::GetLifetimeReplicatedProps(TArray< class FLifetimeProper
 
 	DOREPLIFETIME(UVRLeverComponent, bRepGameplayTags);
 	DOREPLIFETIME(UVRLeverComponent, bReplicateMovement);
+	DOREPLIFETIME_CONDITION(UVRLeverComponent, QuantizedLeverAngle, COND_Custom);
 	DOREPLIFETIME_CONDITION(UVRLeverComponent, GameplayTags, COND_Custom);
 }
 
@@ -88,9 +92,40 @@ void UVRLeverComponent::PreReplication(IRepChangedPropertyTracker & ChangedPrope
 	// Don't replicate if set to not do it
 	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRLeverComponent, GameplayTags, bRepGameplayTags);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement);
+	// Send the packed angle in place of the relative transform if requested
+	bool bRepQuantizedState = bReplicateMovement && CanReplicateQuantizedState();
+
+	if (bRepQuantizedState)
+		QuantizedLeverAngle = UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(FullCurrentAngle, -180.0f, 180.0f);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRLeverComponent, QuantizedLeverAngle, bRepQuantizedState);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement && !bRepQuantizedState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement && !bRepQuantizedState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement && !bRepQuantizedState);
+}
+
+bool UVRLeverComponent::CanReplicateQuantizedState() const
+{
+	if (!bReplicateQuantizedState)
+		return false;
+
+	switch (LeverRotationAxis)
+	{
+	case EVRInteractibleLeverAxis::Axis_X:
+	case EVRInteractibleLeverAxis::Axis_Y:
+	case EVRInteractibleLeverAxis::Axis_Z:
+		return true;
+	default:
+		return false; // Dual axis levers need the full rotation
+	}
+}
+
+void UVRLeverComponent::OnRep_QuantizedLeverAngle()
+{
+	float NewAngle = UVRInteractibleFunctionLibrary::DequantizeInteractibleValue(QuantizedLeverAngle, -180.0f, 180.0f);
+	this->SetRelativeRotation((FTransform(UVRInteractibleFunctionLibrary::SetAxisValueRot((EVRInteractibleAxis)LeverRotationAxis, NewAngle, FRotator::ZeroRotator)) * InitialRelativeTransform).Rotator());
+	ReCalculateCurrentAngle();
 }
 
 void UVRLeverComponent::OnRegister()
@@ -115,6 +150,16 @@ void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 
 	bool bWasLerping = bIsLerping;
 
+	// Out of settle time, stop where we are
+	if (bIsLerping && UVRInteractibleFunctionLibrary::Interactible_UpdateSettleTime(SleepSettings, DeltaTime, SettleTime))
+	{
+		CSV_CUSTOM_STAT(VRExpansion, InteractibleSettleSleeps, 1, ECsvCustomStatOp::Accumulate);
+		this->SetComponentTickEnabled(false);
+		bIsLerping = false;
+		MomentumAtDrop = 0.0f;
+		bReplicateMovement = bOriginalReplicatesMovement;
+	}
+
 	if (bIsLerping)
 	{
 		FTransform CurRelativeTransform = this->GetComponentTransform().GetRelativeTransform(UVRInteractibleFunctionLibrary::Interactible_GetCurrentParentTransform(this));
@@ -134,7 +179,7 @@ void UVRLeverComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 			FRotator curRot = CurRelativeTransform.GetRelativeTransform(InitialRelativeTransform).Rotator();
 			FRotator LerpedRot = FMath::RInterpConstantTo(curRot, FRotator::ZeroRotator, DeltaTime, LeverReturnSpeed);
 
-			if (LerpedRot.Equals(FRotator::ZeroRotator))
+			if (LerpedRot.Equals(FRotator::ZeroRotator) || UVRInteractibleFunctionLibrary::Interactible_IsWithinSettleTolerance(SleepSettings, LerpedRot.GetManhattanDistance(FRotator::ZeroRotator)))
 			{
 				this->SetComponentTickEnabled(false);
 				bIsLerping = false;
@@ -353,6 +398,7 @@ void UVRLeverComponent::OnGripRelease_Implementation(UGripMotionControllerCompon
 	if (LeverReturnTypeWhenReleased != EVRInteractibleLeverReturnType::Stay)
 	{		
 		bIsLerping = true;
+		SettleTime = 0.0f;
 		if (MovementReplicationSetting != EGripMovementReplicationSettings::ForceServerSideMovement)
 			bReplicateMovement = false;
 	}
@@ -758,7 +804,7 @@ void UVRLeverComponent::LerpAxis(float CurrentAngle, float DeltaTime)
 	}break;
 	case EVRInteractibleLeverReturnType::RetainMomentum:
 	{
-		if (FMath::IsNearlyZero(MomentumAtDrop * DeltaTime, 0.1f))
+		if (FMath::IsNearlyZero(MomentumAtDrop * DeltaTime, 0.1f) || UVRInteractibleFunctionLibrary::Interactible_IsWithinSettleTolerance(SleepSettings, MomentumAtDrop * DeltaTime))
 		{
 			MomentumAtDrop = 0.0f;
 			this->SetComponentTickEnabled(false);
@@ -787,7 +833,7 @@ void UVRLeverComponent::LerpAxis(float CurrentAngle, float DeltaTime)
 	//float LerpedVal = FMath::FixedTurn(CurrentAngle, TargetAngle, FinalReturnSpeed * DeltaTime);
 	float LerpedVal = FMath::FInterpConstantTo(CurrentAngle, TargetAngle, DeltaTime, FinalReturnSpeed);
 
-	if (FMath::IsNearlyEqual(LerpedVal, TargetAngle))
+	if (FMath::IsNearlyEqual(LerpedVal, TargetAngle) || UVRInteractibleFunctionLibrary::Interactible_IsWithinSettleTolerance(SleepSettings, LerpedVal - TargetAngle))
 	{
 		if (LeverRestitution > 0.0f)
 		{
@@ -15,6 +15,7 @@ UVRMountComponent::UVRMountComponent(const FObjectInitializer& ObjectInitializer
 
 	// Defaulting these true so that they work by default in networked environments
 	bReplicateMovement = true;
+	bReplicateRotationOnly = false;
 
 	MovementReplicationSetting = EGripMovementReplicationSettings::ForceClientSideMovement;
 	BreakDistance = 100.0f;
@@ -28,6 +29,8 @@ UVRMountComponent::UVRMountComponent(const FObjectInitializer& ObjectInitializer
 	InitialInteractorLocation = FVector::ZeroVector;
 	InitialGripRot = 0.0f;
 	qRotAtGrab = FQuat::Identity;
+	InitialRelativeQuat = FQuat::Identity;
+	InitialGripRadius = 0.0f;
 
 	bDenyGripping = false;
 
@@ -62,9 +65,9 @@ void UVRMountComponent::PreReplication(IRepChangedPropertyTracker & ChangedPrope
 	// Don't replicate if set to not do it
 	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRMountComponent, GameplayTags, bRepGameplayTags);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement && !bReplicateRotationOnly);
 	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement && !bReplicateRotationOnly);
 }
 
 void UVRMountComponent::OnRegister()
@@ -93,6 +96,8 @@ void UVRMountComponent::OnUnregister()
 
 void UVRMountComponent::TickGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation, float DeltaTime)
 {
+	CSV_SCOPED_TIMING_STAT(VRExpansion, MountTickGrip);
+
 	// Handle manual tracking here
 
 	FTransform CurrentRelativeTransform = InitialRelativeTransform * UVRInteractibleFunctionLibrary::Interactible_GetCurrentParentTransform(this);
@@ -112,12 +117,11 @@ void UVRMountComponent::TickGrip_Implementation(UGripMotionControllerComponent *
 		}
 
 		//Rotate the Initial Grip relative to the Forward Axis so it represents the current correct vector after Mount is rotated. 
-		FVector CurToForwardAxisVec = FRotator(RelativeRotation.Pitch, RelativeRotation.Yaw, TwistDiff).RotateVector(InitialGripToForwardVec);
+		//Read fresh each tick so a rotation set from outside while gripped is respected.
+		FVector CurToForwardAxisVec = GetYawPitchTwistQuat(RelativeRotation.Quaternion(), TwistDiff).RotateVector(InitialGripToForwardVec);
 
 		//The Current InteractorLocation based on current interactor location to intersection point on sphere with forward axis. 
-		CurInteractorLocation = (CurInteractorLocation.GetSafeNormal() * InitialInteractorLocation.Size() + CurToForwardAxisVec).GetSafeNormal()*CurInteractorLocation.Size();
-
-		FRotator Rot;
+		CurInteractorLocation = (CurInteractorLocation.GetSafeNormal() * InitialGripRadius + CurToForwardAxisVec).GetSafeNormal()*CurInteractorLocation.Size();
 
 		//If we are inside the fliping zone defined from Cone Area on top or bottom. ToDo: This probably can be combined with later FlipZone.
 		if (bIsInsideFrontFlipingZone || bIsInsideBackFlipZone)
@@ -195,14 +199,12 @@ void UVRMountComponent::TickGrip_Implementation(UGripMotionControllerComponent *
 
 		}
 
-		//Setting the relative rotation once before using "accumulated" relative rotation to calculate roll onto it.
-		Rot = MountToTarget.Rotation();
-		this->SetRelativeRotation((FTransform(FRotator(Rot.Pitch, Rot.Yaw, 0))*InitialRelativeTransform).Rotator());
-
+		//The relative rotation without roll, roll is added onto it at the end and set in one go so children only update once.
+		//Up and right vectors below are read from this instead of the component since it hasn't been set yet.
+		const FQuat MountBaseQuat = InitialRelativeQuat * MountToTarget.ToOrientationQuat();
 
-		FVector nAxis;
-		float FlipAngle;
-		FQuat::FindBetweenVectors(FVector(0, 0, 1), CurInteractorLocation.GetSafeNormal()).ToAxisAndAngle(nAxis, FlipAngle);
+		//Angle between relative up and the interactor
+		const float FlipAngle = FMath::Acos(FMath::Clamp(CurInteractorLocation.GetSafeNormal().Z, -1.0f, 1.0f));
 
 		// This part takes care of the roll rotation ff Mount is inside flipping zone on top or on bottom.
 		if (FlipAngle < FlipingZone || FlipAngle > PI - FlipingZone)
@@ -213,17 +215,9 @@ void UVRMountComponent::TickGrip_Implementation(UGripMotionControllerComponent *
 				//We entered the FrontFlipzone
 				bIsInsideFrontFlipingZone = true;
 
-				//Up and Right Vector when entering the FlipZone. Parent Rotation is accounted for.
-				if (USceneComponent * ParentComp = GetAttachParent())
-				{
-					EntryUpVec = ParentComp->GetComponentRotation().UnrotateVector(GetUpVector());
-					EntryRightVec = ParentComp->GetComponentRotation().UnrotateVector(GetRightVector());
-				}
-				else
-				{
-					EntryUpVec = GetUpVector();
-					EntryRightVec = GetRightVector();
-				}
+				//Up and Right Vector when entering the FlipZone, already relative to the parent.
+				EntryUpVec = MountBaseQuat.GetUpVector();
+				EntryRightVec = MountBaseQuat.GetRightVector();
 
 				//Only relative x and y is important for a Mount which has XY rotation limitation for the flip plane.
 				EntryUpXYNeg = FVector(EntryUpVec.X, EntryUpVec.Y, 0).GetSafeNormal()*-1;
@@ -263,10 +257,7 @@ void UVRMountComponent::TickGrip_Implementation(UGripMotionControllerComponent *
 				{
 					//If Mount Rotation is still inside FrontFlipZone ajust the roll so it looks naturally when moving the Mount against the FlipPlane
 
-					FVector RelativeUpVec = GetUpVector();
-					
-					if(USceneComponent * ParentComp = GetAttachParent())
-						RelativeUpVec = ParentComp->GetComponentRotation().UnrotateVector(RelativeUpVec);
+					FVector RelativeUpVec = MountBaseQuat.GetUpVector();
 
 					FVector CurrentUpVec = FVector(RelativeUpVec.X, RelativeUpVec.Y, 0).GetSafeNormal();
 
@@ -342,8 +333,8 @@ void UVRMountComponent::TickGrip_Implementation(UGripMotionControllerComponent *
 
 		}
 
-		//Add Roll modifications to accumulated LocalRotation.
-		this->AddLocalRotation(FRotator(0, 0, -TwistDiff));
+		//Add Roll modifications in local space and apply the final rotation.
+		this->SetRelativeRotation(MountBaseQuat * FQuat(FVector::ForwardVector, FMath::DegreesToRadians(TwistDiff)));
 
 	}break;
 	default:break;
@@ -376,6 +367,10 @@ void UVRMountComponent::OnGrip_Implementation(UGripMotionControllerComponent * G
 	{
 		//spaceharry
 
+		// Cache the grip time frames so the tick doesn't need to rebuild them
+		InitialRelativeQuat = InitialRelativeTransform.GetRotation();
+		InitialGripRadius = InitialInteractorLocation.Size();
+
 		qRotAtGrab = this->GetComponentTransform().GetRelativeTransform(CurrentRelativeTransform).GetRotation();
 
 		FVector ForwardVectorToUse = GetForwardVector();
@@ -399,7 +394,7 @@ void UVRMountComponent::OnGrip_Implementation(UGripMotionControllerComponent * G
 		}
 
 
-		InitialGripToForwardVec = FRotator(RelativeRotation.Pitch, RelativeRotation.Yaw, TwistDiff).UnrotateVector(InitialGripToForwardVec);
+		InitialGripToForwardVec = GetYawPitchTwistQuat(RelativeRotation.Quaternion(), TwistDiff).UnrotateVector(InitialGripToForwardVec);
 
 	}break;
 	default:break;
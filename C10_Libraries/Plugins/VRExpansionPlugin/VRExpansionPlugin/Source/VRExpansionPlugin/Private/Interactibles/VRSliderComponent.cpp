@@ -15,6 +15,8 @@ UVRSliderComponent::UVRSliderComponent(const FObjectInitializer& ObjectInitializ
 
 	// Defaulting these true so that they work by default in networked environments
 	bReplicateMovement = true;
+	bReplicateQuantizedState = false;
+	QuantizedSliderProgress = 0;
 
 	MovementReplicationSetting = EGripMovementReplicationSettings::ForceClientSideMovement;
 	BreakDistance = 100.0f;
@@ -29,6 +31,7 @@ UVRSliderComponent::UVRSliderComponent(const FObjectInitializer& ObjectInitializ
 	LastSliderProgress = 0.0f;
 	
 	MomentumAtDrop = 0.0f;
+	SettleTime = 0.0f;
 	SliderMomentumFriction = 3.0f;
 	MaxSliderMomentum = 1.0f;
 	FramesToAverage = 3;
@@ -73,6 +76,7 @@ void UVRSliderComponent::GetLifetimeReplicatedProps(TArray< class FLifetimePrope
 
 	DOREPLIFETIME(UVRSliderComponent, bRepGameplayTags);
 	DOREPLIFETIME(UVRSliderComponent, bReplicateMovement);
+	DOREPLIFETIME_CONDITION(UVRSliderComponent, QuantizedSliderProgress, COND_Custom);
 	DOREPLIFETIME_CONDITION(UVRSliderComponent, GameplayTags, COND_Custom);
 }
 
@@ -87,9 +91,31 @@ void UVRSliderComponent::PreReplication(IRepChangedPropertyTracker & ChangedProp
 	// Don't replicate if set to not do it
 	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRSliderComponent, GameplayTags, bRepGameplayTags);
 
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement);
-	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement);
+	// Send the packed progress in place of the relative transform if requested
+	bool bRepQuantizedState = bReplicateMovement && CanReplicateQuantizedState();
+
+	if (bRepQuantizedState)
+		QuantizedSliderProgress = UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(CurrentSliderProgress, 0.0f, 1.0f);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UVRSliderComponent, QuantizedSliderProgress, bRepQuantizedState);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeLocation, bReplicateMovement && !bRepQuantizedState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeRotation, bReplicateMovement && !bRepQuantizedState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(USceneComponent, RelativeScale3D, bReplicateMovement && !bRepQuantizedState);
+}
+
+bool UVRSliderComponent::CanReplicateQuantizedState() const
+{
+	if (!bReplicateQuantizedState)
+		return false;
+
+	if (SplineComponentToFollow != nullptr)
+		return true;
+
+	// Multi axis sliders move freely inside of their box so the progress alone can't rebuild the location
+	FVector SlideRange = MinSlideDistance + MaxSlideDistance;
+	int32 NumSlideAxis = (FMath::IsNearlyZero(SlideRange.X) ? 0 : 1) + (FMath::IsNearlyZero(SlideRange.Y) ? 0 : 1) + (FMath::IsNearlyZero(SlideRange.Z) ? 0 : 1);
+	return NumSlideAxis <= 1;
 }
 
 void UVRSliderComponent::OnRegister()
@@ -124,8 +150,15 @@ void UVRSliderComponent::TickComponent(float DeltaTime, enum ELevelTick TickType
 
 	if (bIsLerping)
 	{
-		if (FMath::IsNearlyZero(MomentumAtDrop * DeltaTime, 0.00001f))
+		if (FMath::IsNearlyZero(MomentumAtDrop * DeltaTime, 0.00001f) || UVRInteractibleFunctionLibrary::Interactible_IsWithinSettleTolerance(SleepSettings, MomentumAtDrop * DeltaTime))
+		{
+			bIsLerping = false;
+		}
+		else if (UVRInteractibleFunctionLibrary::Interactible_UpdateSettleTime(SleepSettings, DeltaTime, SettleTime))
 		{
+			// Out of settle time, stop where we are
+			CSV_CUSTOM_STAT(VRExpansion, InteractibleSettleSleeps, 1, ECsvCustomStatOp::Accumulate);
+			MomentumAtDrop = 0.0f;
 			bIsLerping = false;
 		}
 		else
@@ -372,6 +405,7 @@ void UVRSliderComponent::OnGripRelease_Implementation(UGripMotionControllerCompo
 	if (SliderBehaviorWhenReleased != EVRInteractibleSliderDropBehavior::Stay)
 	{
 		bIsLerping = true;
+		SettleTime = 0.0f;
 		this->SetComponentTickEnabled(true);
 
 		if(MovementReplicationSetting != EGripMovementReplicationSettings::ForceServerSideMovement)
@@ -13,6 +13,10 @@ UVRLogComponent::UVRLogComponent(const FObjectInitializer& ObjectInitializer)
 	PrimaryComponentTick.bCanEverTick = false;
 	MaxLineLength = 130;
 	MaxStoredMessages = 10000;
+
+	LastDrawnScrollPos = INDEX_NONE;
+	CachedLineHeight = 0.0f;
+	OutputLogDrawItemCount = 0;
 }
 
 //=============================================================================
@@ -66,11 +70,15 @@ void UVRLogComponent::AppendTextToConsole(FString Text, bool bReturnAtEnd)
 
 bool UVRLogComponent::DrawConsoleToRenderTarget2D(EBPVRConsoleDrawType DrawType, UTextureRenderTarget2D * Texture, float ScrollOffset, bool bForceDraw)
 {
-	if (!bForceDraw && DrawType == EBPVRConsoleDrawType::VRConsole_Draw_OutputLogOnly && !OutputLogHistory.bIsDirty)
+	if (!Texture)
+		return false;
+
+	// Output log only needs to redraw when new messages came in, we scrolled, or we are drawing to a new target
+	if (!bForceDraw && DrawType == EBPVRConsoleDrawType::VRConsole_Draw_OutputLogOnly && !OutputLogHistory.bIsDirty &&
+		LastDrawnScrollPos == GetOutputLogScrollPos(ScrollOffset) && LastDrawnRenderTarget.Get() == Texture)
 	{
 		return false;
 	}
-	//LastRenderedOutputLogSize 
 
 //	check(WorldContextObject);
 	UWorld* World = GetWorld();//GEngine->GetWorldFromContextObject(WorldContextObject, false);
@@ -101,8 +109,8 @@ bool UVRLogComponent::DrawConsoleToRenderTarget2D(EBPVRConsoleDrawType DrawType,
 	switch (DrawType)
 	{
 	//case EBPVRConsoleDrawType::VRConsole_Draw_ConsoleAndOutputLog: DrawConsole(true, Canvas); DrawOutputLog(true, Canvas); break;
-	case EBPVRConsoleDrawType::VRConsole_Draw_ConsoleOnly: DrawConsole(false, Canvas); break;
-	case EBPVRConsoleDrawType::VRConsole_Draw_OutputLogOnly: DrawOutputLog(false, Canvas, ScrollOffset); break;
+	case EBPVRConsoleDrawType::VRConsole_Draw_ConsoleOnly: DrawConsole(false, Canvas); LastDrawnRenderTarget = nullptr; break;
+	case EBPVRConsoleDrawType::VRConsole_Draw_OutputLogOnly: DrawOutputLog(false, Canvas, ScrollOffset); LastDrawnRenderTarget = Texture; break;
 	default: break;
 	}
 
@@ -141,13 +149,29 @@ void UVRLogComponent::DrawConsole(bool bLowerHalf, UCanvas* Canvas)
 
 }
 
+int32 UVRLogComponent::GetOutputLogScrollPos(float ScrollOffset) const
+{
+	const int32 NumMessages = OutputLogHistory.GetMessages().Num();
+
+	if (ScrollOffset > 0 && NumMessages > 1)
+		return FMath::Clamp(FMath::RoundToInt(NumMessages * ScrollOffset), 0, NumMessages - 1);
+
+	return 0;
+}
+
 void UVRLogComponent::DrawOutputLog(bool bUpperHalf, UCanvas* Canvas, float ScrollOffset)
 {
 	UFont* Font = GEngine->GetSmallFont();// GEngine->GetTinyFont();//GEngine->GetSmallFont();
 
-	// determine the height of the text
-	float xl, yl;
-	Canvas->StrLen(Font, TEXT("M"), xl, yl);
+	// determine the height of the text, only re-measured if the font changes
+	if (CachedLineFont.Get() != Font)
+	{
+		float xl;
+		Canvas->StrLen(Font, TEXT("M"), xl, CachedLineHeight);
+		CachedLineFont = Font;
+	}
+
+	const float yl = CachedLineHeight;
 	float Height = FMath::FloorToFloat(Canvas->ClipY);// *0.75f);
 
 
@@ -160,15 +184,14 @@ void UVRLogComponent::DrawOutputLog(bool bUpperHalf, UCanvas* Canvas, float Scro
 	ConsoleTile.BlendMode = SE_BLEND_AlphaBlend;
 
 	Canvas->DrawItem(ConsoleTile);
+	++OutputLogDrawItemCount;
 
 	FCanvasTextItem ConsoleText(FVector2D(0, 0 + Height - 5 - yl), FText::FromString(TEXT("")), Font, FColor::Emerald);
 
-	const TArray< TSharedPtr<FVRLogMessage> > LoggedMessages = OutputLogHistory.GetMessages();
+	// Reference, don't copy the entire history every draw
+	const TArray< TSharedPtr<FVRLogMessage> >& LoggedMessages = OutputLogHistory.GetMessages();
 	
-	int32 ScrollPos = 0;
-
-	if(ScrollOffset > 0 && LoggedMessages.Num() > 1)
-		ScrollPos = FMath::Clamp(FMath::RoundToInt(LoggedMessages.Num() * ScrollOffset ) , 0, LoggedMessages.Num() - 1);
+	const int32 ScrollPos = GetOutputLogScrollPos(ScrollOffset);
 
 	float Xpos = 0.0f;
 	float Ypos = 0.0f;
@@ -186,11 +209,13 @@ void UVRLogComponent::DrawOutputLog(bool bUpperHalf, UCanvas* Canvas, float Scro
 		}
 
 		Ypos += yl;
-		ConsoleText.Text = FText::Format(NSLOCTEXT("VRLogComponent", "ConsoleFormat", "{0}"), FText::FromString(*LoggedMessages[i]->Message));
+		ConsoleText.Text = LoggedMessages[i]->GetDisplayText();
 		Canvas->DrawItem(ConsoleText, 0, Height - Ypos);
+		++OutputLogDrawItemCount;
 	}
 
 	OutputLogHistory.bIsDirty = false;
+	LastDrawnScrollPos = ScrollPos;
 }
 
 
@@ -0,0 +1,169 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRWheeledVehicle.h"
+#include "Misc/VRWheeledVehicleMovementComponent.h"
+#include "VRBPDatatypes.h"
+
+namespace VRWheeledVehicleInput
+{
+	// Bit layout of the packed input
+	static const uint32 SteeringBits = 9;
+	static const uint32 ThrottleBits = 9;
+	static const uint32 BrakeBits = 8;
+	static const uint32 GearBits = 5;
+
+	static const uint32 ThrottleShift = SteeringBits;
+	static const uint32 BrakeShift = ThrottleShift + ThrottleBits;
+	static const uint32 HandbrakeShift = BrakeShift + BrakeBits;
+	static const uint32 GearShift = HandbrakeShift + 1;
+
+	FORCEINLINE uint32 Quantize(float Value, float Min, float Max, uint32 Bits)
+	{
+		const uint32 MaxValue = (1u << Bits) - 1u;
+		return (uint32)FMath::RoundToInt(FMath::GetMappedRangeValueClamped(FVector2D(Min, Max), FVector2D(0.f, (float)MaxValue), Value));
+	}
+
+	FORCEINLINE float Dequantize(uint32 Packed, uint32 Shift, float Min, float Max, uint32 Bits)
+	{
+		const uint32 MaxValue = (1u << Bits) - 1u;
+		return FMath::Lerp(Min, Max, (float)((Packed >> Shift) & MaxValue) / (float)MaxValue);
+	}
+}
+
+AVRWheeledVehicle::AVRWheeledVehicle(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	PrimaryActorTick.bCanEverTick = true;
+
+	bUsePackedInputUplink = false;
+	PackedInputResendInterval = 0.1f;
+
+	LocalPackedInput = 0;
+	LastSentPackedInput = 0;
+	LastPackedInputSendTime = 0.0f;
+	bHasLocalPackedInput = false;
+}
+
+uint32 AVRWheeledVehicle::PackVehicleInput(float Steering, float Throttle, float Brake, bool bHandbrake, int32 Gear)
+{
+	using namespace VRWheeledVehicleInput;
+
+	// Gear is offset by one so reverse (-1) fits
+	const uint32 GearValue = (uint32)FMath::Clamp(Gear + 1, 0, (int32)((1u << GearBits) - 1u));
+
+	return Quantize(Steering, -1.0f, 1.0f, SteeringBits) |
+		(Quantize(Throttle, -1.0f, 1.0f, ThrottleBits) << ThrottleShift) |
+		(Quantize(Brake, 0.0f, 1.0f, BrakeBits) << BrakeShift) |
+		((bHandbrake ? 1u : 0u) << HandbrakeShift) |
+		(GearValue << GearShift);
+}
+
+void AVRWheeledVehicle::UnpackVehicleInput(uint32 PackedInput, float & Steering, float & Throttle, float & Brake, bool & bHandbrake, int32 & Gear)
+{
+	using namespace VRWheeledVehicleInput;
+
+	Steering = Dequantize(PackedInput, 0, -1.0f, 1.0f, SteeringBits);
+	Throttle = Dequantize(PackedInput, ThrottleShift, -1.0f, 1.0f, ThrottleBits);
+	Brake = Dequantize(PackedInput, BrakeShift, 0.0f, 1.0f, BrakeBits);
+	bHandbrake = ((PackedInput >> HandbrakeShift) & 1u) != 0;
+	Gear = (int32)((PackedInput >> GearShift) & ((1u << GearBits) - 1u)) - 1;
+
+	// The signed ranges have no exact center value, snap it back to zero so the vehicle can idle
+	if (FMath::Abs(Steering) < 0.5f / ((1u << (SteeringBits - 1)) - 1u))
+		Steering = 0.0f;
+	if (FMath::Abs(Throttle) < 0.5f / ((1u << (ThrottleBits - 1)) - 1u))
+		Throttle = 0.0f;
+}
+
+bool AVRWheeledVehicle::ShouldSendPackedInput(uint32 PackedInput, uint32 LastSentPackedInput, float TimeSinceLastSend, float ResendInterval)
+{
+	return PackedInput != LastSentPackedInput || TimeSinceLastSend >= ResendInterval;
+}
+
+void AVRWheeledVehicle::SetPackedVehicleInputs(float Steering, float Throttle, float Brake, bool bHandbrake)
+{
+	if (!bUsePackedInputUplink)
+		return;
+
+	UWheeledVehicleMovementComponent * MoveComp = GetVehicleMovementComponent();
+	LocalPackedInput = PackVehicleInput(Steering, Throttle, Brake, bHandbrake, MoveComp ? MoveComp->GetCurrentGear() : 0);
+	bHasLocalPackedInput = true;
+}
+
+void AVRWheeledVehicle::ClearPackedVehicleInputs()
+{
+	if (!bHasLocalPackedInput)
+		return;
+
+	// Send a final neutral input so the server doesn't keep driving
+	SetPackedVehicleInputs(0.0f, 0.0f, 0.0f, false);
+	ApplyPackedVehicleInput(LocalPackedInput);
+
+	if (Role != ROLE_Authority)
+		ServerSendPackedVehicleInput(LocalPackedInput);
+
+	bHasLocalPackedInput = false;
+}
+
+void AVRWheeledVehicle::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!bUsePackedInputUplink || !bHasLocalPackedInput)
+		return;
+
+	// Apply locally every tick (pre physics) so replicated state from the server doesn't override the predicted input
+	ApplyPackedVehicleInput(LocalPackedInput);
+
+	if (Role == ROLE_Authority)
+		return;
+
+	const float CurTime = GetWorld()->GetTimeSeconds();
+	if (ShouldSendPackedInput(LocalPackedInput, LastSentPackedInput, CurTime - LastPackedInputSendTime, PackedInputResendInterval))
+	{
+		CSV_CUSTOM_STAT(VRExpansion, VehicleInputUplinkSends, 1, ECsvCustomStatOp::Accumulate);
+		ServerSendPackedVehicleInput(LocalPackedInput);
+		LastSentPackedInput = LocalPackedInput;
+		LastPackedInputSendTime = CurTime;
+	}
+}
+
+bool AVRWheeledVehicle::ServerSendPackedVehicleInput_Validate(uint32 PackedInput)
+{
+	return true;
+}
+
+void AVRWheeledVehicle::ServerSendPackedVehicleInput_Implementation(uint32 PackedInput)
+{
+	if (!bUsePackedInputUplink)
+		return;
+
+	ApplyPackedVehicleInput(PackedInput);
+}
+
+void AVRWheeledVehicle::ApplyPackedVehicleInput(uint32 PackedInput)
+{
+	UWheeledVehicleMovementComponent * MoveComp = GetVehicleMovementComponent();
+	if (!MoveComp)
+		return;
+
+	float Steering, Throttle, Brake;
+	bool bHandbrake;
+	int32 Gear;
+	UnpackVehicleInput(PackedInput, Steering, Throttle, Brake, bHandbrake, Gear);
+
+	if (UVRWheeledVehicleMovementComponent4W * VRMoveComp = Cast<UVRWheeledVehicleMovementComponent4W>(MoveComp))
+	{
+		// Same state the engines own input RPC sets, read by the vehicle whether or not it is locally controlled
+		VRMoveComp->SetVehicleInputState(Steering, Throttle, Brake, bHandbrake ? 1.0f : 0.0f, Gear);
+	}
+	else
+	{
+		// Raw inputs are only read when the vehicle is locally controlled
+		MoveComp->SetSteeringInput(Steering);
+		MoveComp->SetThrottleInput(Throttle);
+		MoveComp->SetBrakeInput(Brake);
+		MoveComp->SetHandbrakeInput(bHandbrake);
+		MoveComp->SetTargetGear(Gear, true);
+	}
+}
@@ -0,0 +1,15 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRWheeledVehicleMovementComponent.h"
+
+void UVRWheeledVehicleMovementComponent4W::SetVehicleInputState(float InSteeringInput, float InThrottleInput, float InBrakeInput, float InHandbrakeInput, int32 InCurrentGear)
+{
+	SetTargetGear(InCurrentGear, true);
+
+	// Also the replicated state, so simulated proxies see the same inputs
+	ReplicatedState.SteeringInput = InSteeringInput;
+	ReplicatedState.ThrottleInput = InThrottleInput;
+	ReplicatedState.BrakeInput = InBrakeInput;
+	ReplicatedState.HandbrakeInput = InHandbrakeInput;
+	ReplicatedState.CurrentGear = InCurrentGear;
+}
@@ -60,7 +60,7 @@ void UParentRelativeAttachmentComponent::TickComponent(float DeltaTime, enum ELe
 	{
 		FQuat curRot;
 		FVector curCameraLoc;
-		if (GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, curRot, curCameraLoc))
+		if (UVRExpansionFunctionLibrary::GetHMDPoseForFrame(curRot, curCameraLoc))
 		{
 			if (bOffsetByHMD)
 			{
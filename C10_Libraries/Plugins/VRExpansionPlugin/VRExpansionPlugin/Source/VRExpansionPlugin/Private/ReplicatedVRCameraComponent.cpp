@@ -120,7 +120,7 @@ void UReplicatedVRCameraComponent::TickComponent(float DeltaTime, enum ELevelTic
 			//ResetRelativeTransform();
 			FQuat Orientation;
 			FVector Position;
-			if (GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, Orientation, Position))
+			if (UVRExpansionFunctionLibrary::GetHMDPoseForFrame(Orientation, Position))
 			{
 				if (bOffsetByHMD)
 				{
@@ -9,6 +9,7 @@
 #include "GameFramework/PhysicsVolume.h"
 #include "GameFramework/GameNetworkManager.h"
 #include "IHeadMountedDisplay.h"
+#include "VRExpansionFunctionLibrary.h"
 #include "SimpleChar/VRSimpleCharacter.h"
 #include "NavigationSystem.h"
 #include "GameFramework/Character.h"
@@ -55,6 +56,10 @@ UVRSimpleCharacterMovementComponent::UVRSimpleCharacterMovementComponent(const F
 	PostPhysicsTickFunction.bStartWithTickEnabled = false;
 	PrimaryComponentTick.TickGroup = TG_PrePhysics;
 	VRRootCapsule = NULL;
+	OwningSimpleCharacter = nullptr;
+	bHasGeneratedOffsetToWorld = false;
+	NumTransformPushes = 0;
+	NumOffsetToWorldUpdates = 0;
 	//VRCameraCollider = NULL;
 
 	this->bRequestedMoveUseAcceleration = false;
@@ -1005,6 +1010,8 @@ void UVRSimpleCharacterMovementComponent::PhysWalking(float deltaTime, int32 Ite
 
 void UVRSimpleCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction)
 {
+	CSV_SCOPED_TIMING_STAT(VRExpansion, VRSimpleCharacterMovementTick);
+
 	if (!bSkipHMDChecks)
 	{
 		if (CharacterOwner->IsLocallyControlled())
@@ -1016,7 +1023,7 @@ void UVRSimpleCharacterMovementComponent::TickComponent(float DeltaTime, enum EL
 			{
 				bWasHeadset = true;
 
-				if (GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, curRot, curCameraLoc))
+				if (UVRExpansionFunctionLibrary::GetHMDPoseForFrame(curRot, curCameraLoc))
 				{
 					curCameraRot = curRot.Rotator();
 				}
@@ -1030,7 +1037,14 @@ void UVRSimpleCharacterMovementComponent::TickComponent(float DeltaTime, enum EL
 			{
 				curCameraLoc = VRCameraComponent->RelativeLocation;
 				curCameraRot = VRCameraComponent->RelativeRotation;
-				VRCameraComponent->SetRelativeLocation(FVector(0, 0, VRCameraComponent->RelativeLocation.Z));
+
+				// Only once something actually moved the camera off of the capsule
+				if (VRCameraComponent->RelativeLocation.X != 0.0f || VRCameraComponent->RelativeLocation.Y != 0.0f)
+				{
+					CSV_CUSTOM_STAT(VRExpansion, SimpleCharTransformPushes, 1, ECsvCustomStatOp::Accumulate);
+					++NumTransformPushes;
+					VRCameraComponent->SetRelativeLocation(FVector(0, 0, VRCameraComponent->RelativeLocation.Z));
+				}
 			}
 
 			if (!bIsFirstTick)
@@ -1066,12 +1080,33 @@ void UVRSimpleCharacterMovementComponent::TickComponent(float DeltaTime, enum EL
 
 		Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-		if (AVRSimpleCharacter * owningChar = Cast<AVRSimpleCharacter>(GetOwner()))
+		if (OwningSimpleCharacter)
 		{
+			// Setting it propagates down the camera and hands, so only when the half height changed
 			if (VRRootCapsule)
-				owningChar->VRSceneComponent->SetRelativeLocation(FVector(0, 0, -VRRootCapsule->GetUnscaledCapsuleHalfHeight()));
+			{
+				const FVector SceneOffset(0, 0, -VRRootCapsule->GetUnscaledCapsuleHalfHeight());
+				if (OwningSimpleCharacter->VRSceneComponent->RelativeLocation != SceneOffset)
+				{
+					CSV_CUSTOM_STAT(VRExpansion, SimpleCharTransformPushes, 1, ECsvCustomStatOp::Accumulate);
+					++NumTransformPushes;
+					OwningSimpleCharacter->VRSceneComponent->SetRelativeLocation(SceneOffset);
+				}
+			}
 
-			owningChar->GenerateOffsetToWorld();
+			// The offset is only built from the actor transform and the camera rotation
+			const FVector ActorLocation = OwningSimpleCharacter->GetActorLocation();
+			const FVector ActorScale = OwningSimpleCharacter->GetActorScale3D();
+			const FQuat CameraRotation = OwningSimpleCharacter->VRReplicatedCamera->GetComponentQuat();
+			if (!bHasGeneratedOffsetToWorld || ActorLocation != LastOffsetActorLocation || ActorScale != LastOffsetActorScale || !CameraRotation.Equals(LastOffsetCameraRotation, 0.0f))
+			{
+				OwningSimpleCharacter->GenerateOffsetToWorld();
+				++NumOffsetToWorldUpdates;
+				LastOffsetActorLocation = ActorLocation;
+				LastOffsetActorScale = ActorScale;
+				LastOffsetCameraRotation = CameraRotation;
+				bHasGeneratedOffsetToWorld = true;
+			}
 		}
 	}
 	else
@@ -1087,9 +1122,12 @@ void UVRSimpleCharacterMovementComponent::SetUpdatedComponent(USceneComponent* N
 		// Fill the VRRootCapsule if we can
 		VRRootCapsule = Cast<UCapsuleComponent>(UpdatedComponent);
 
-		if (AVRSimpleCharacter * simpleChar = Cast<AVRSimpleCharacter>(GetOwner()))
+		OwningSimpleCharacter = Cast<AVRSimpleCharacter>(GetOwner());
+		bHasGeneratedOffsetToWorld = false;
+
+		if (OwningSimpleCharacter)
 		{
-			VRCameraComponent = Cast<UCameraComponent>(simpleChar->VRReplicatedCamera);
+			VRCameraComponent = Cast<UCameraComponent>(OwningSimpleCharacter->VRReplicatedCamera);
 		}
 
 		// Stop the tick forcing
@@ -0,0 +1,216 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Animation/ArmSolver.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ArmSolverTestStatics
+{
+	// Standing at the origin facing down X
+	static const FTransform HMDTransform(FRotator::ZeroRotator, FVector(0.f, 0.f, 170.f));
+
+	// Random but repeatable avatars with hands anywhere from tucked in to well out of reach
+	static void FillBatch(FArmSolverBatch & Batch, int32 NumAvatars, int32 Seed)
+	{
+		FRandomStream Stream(Seed);
+		Batch.Reset(NumAvatars * 2);
+
+		for (int32 i = 0; i < NumAvatars; ++i)
+		{
+			const FTransform HMD(FRotator(Stream.FRandRange(-30.f, 30.f), Stream.FRandRange(-180.f, 180.f), 0.f), Stream.VRand() * 200.f + FVector(0.f, 0.f, 170.f));
+			const FTransform Left(FRotator(Stream.FRandRange(-90.f, 90.f), Stream.FRandRange(-180.f, 180.f), 0.f), HMD.GetLocation() + Stream.VRand() * Stream.FRandRange(5.f, 90.f));
+			const FTransform Right(FRotator(Stream.FRandRange(-90.f, 90.f), Stream.FRandRange(-180.f, 180.f), 0.f), HMD.GetLocation() + Stream.VRand() * Stream.FRandRange(5.f, 90.f));
+			Batch.AddAvatar(HMD, Left, Right);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FArmSolverReachLimitTest, "VRExpansionPlugin.ArmSolver.ReachLimit", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FArmSolverReachLimitTest::RunTest(const FString & Parameters)
+{
+	using namespace ArmSolverTestStatics;
+
+	ArmSolver Solver;
+	const float ArmLength = Solver.upperArmLength + Solver.lowerArmLength;
+
+	for (int32 Side = 0; Side < 2; ++Side)
+	{
+		const bool bLeftArm = Side == 0;
+		FArmSolverResult Result;
+
+		// Find the shoulder with a hand that is in reach
+		Solver.SolveArm(HMDTransform, FTransform(HMDTransform.GetLocation() + FVector(30.f, 0.f, -30.f)), bLeftArm, Result);
+		const FVector Shoulder = Result.ShoulderLocation;
+
+		const FVector InReach = Shoulder + FVector(30.f, bLeftArm ? -10.f : 10.f, 0.f);
+		Solver.SolveArm(HMDTransform, FTransform(InReach), bLeftArm, Result);
+		TestFalse(TEXT("Hand in reach is not at the reach limit"), Result.bAtReachLimit);
+		TestTrue(TEXT("Wrist reaches a hand in reach"), Result.WristLocation.Equals(InReach, KINDA_SMALL_NUMBER * 10.f));
+		TestEqual(TEXT("Upper arm keeps its length"), FVector::Dist(Result.ShoulderLocation, Result.ElbowLocation), Solver.upperArmLength, 0.01f);
+		TestEqual(TEXT("Lower arm keeps its length"), FVector::Dist(Result.ElbowLocation, Result.WristLocation), Solver.lowerArmLength, 0.01f);
+
+		const FVector OutOfReach = Shoulder + FVector(100.f, bLeftArm ? -50.f : 50.f, 20.f);
+		Solver.SolveArm(HMDTransform, FTransform(OutOfReach), bLeftArm, Result);
+		TestTrue(TEXT("Hand out of reach is at the reach limit"), Result.bAtReachLimit);
+		TestTrue(TEXT("Wrist stays on the line to the hand"), ((Result.WristLocation - Shoulder).GetSafeNormal() | (OutOfReach - Shoulder).GetSafeNormal()) > 1.f - KINDA_SMALL_NUMBER);
+		TestTrue(TEXT("Wrist is clamped to the arm length"), FVector::Dist(Shoulder, Result.WristLocation) <= ArmLength);
+		TestEqual(TEXT("Upper arm keeps its length at the reach limit"), FVector::Dist(Result.ShoulderLocation, Result.ElbowLocation), Solver.upperArmLength, 0.01f);
+		TestEqual(TEXT("Lower arm keeps its length at the reach limit"), FVector::Dist(Result.ElbowLocation, Result.WristLocation), Solver.lowerArmLength, 0.01f);
+
+		// The hand in the shoulder can't fold the arm shorter than the difference of its bones
+		Solver.SolveArm(HMDTransform, FTransform(Shoulder), bLeftArm, Result);
+		TestFalse(TEXT("Hand at the shoulder is not at the reach limit"), Result.bAtReachLimit);
+		TestFalse(TEXT("Hand at the shoulder has no NaN elbow"), Result.ElbowLocation.ContainsNaN());
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FArmSolverElbowClampTest, "VRExpansionPlugin.ArmSolver.ElbowClamp", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FArmSolverElbowClampTest::RunTest(const FString & Parameters)
+{
+	ArmSolver Solver;
+
+	// Low and forward gives a raw angle past maxAngle, high and across the body one under minAngle
+	const FVector HighAnglePos(0.6f, 0.f, -1.f);
+	const FVector LowAnglePos(0.6f, -1.5f, 1.f);
+
+	Solver.clampElbowAngle = false;
+	const float RawHigh = Solver.GetElbowTargetAngle(HighAnglePos, false);
+	const float RawLow = Solver.GetElbowTargetAngle(LowAnglePos, false);
+	TestTrue(TEXT("Raw angle goes past maxAngle"), RawHigh > Solver.maxAngle);
+	TestTrue(TEXT("Raw angle goes under minAngle"), RawLow < Solver.minAngle);
+
+	Solver.clampElbowAngle = true;
+	Solver.softClampElbowAngle = false;
+	TestEqual(TEXT("Hard clamp stops at maxAngle"), Solver.GetElbowTargetAngle(HighAnglePos, false), Solver.maxAngle);
+	TestEqual(TEXT("Hard clamp stops at minAngle"), Solver.GetElbowTargetAngle(LowAnglePos, false), Solver.minAngle);
+
+	Solver.softClampElbowAngle = true;
+	TestEqual(TEXT("Soft clamp stops at maxAngle"), Solver.GetElbowTargetAngle(HighAnglePos, false), Solver.maxAngle);
+
+	// Sweep the hand across the body, the raw angle rises the whole way
+	float LastSoftAngle = -BIG_NUMBER;
+	for (float Right = -1.5f; Right <= 0.f; Right += 0.05f)
+	{
+		const FVector HandPos(0.6f, Right, 1.f);
+
+		Solver.clampElbowAngle = false;
+		const float Raw = Solver.GetElbowTargetAngle(HandPos, false);
+
+		Solver.clampElbowAngle = true;
+		const float Soft = Solver.GetElbowTargetAngle(HandPos, false);
+
+		TestTrue(TEXT("Soft clamp stays above minAngle"), Soft > Solver.minAngle);
+		TestTrue(TEXT("Soft clamp only raises the angle"), Soft >= Raw - KINDA_SMALL_NUMBER);
+		TestTrue(TEXT("Soft clamp keeps the angle order"), Soft >= LastSoftAngle - KINDA_SMALL_NUMBER);
+
+		if (Raw >= Solver.minAngle + Solver.softClampRange && Raw <= Solver.maxAngle)
+		{
+			TestEqual(TEXT("Soft clamp leaves angles outside of its range alone"), Soft, Raw, KINDA_SMALL_NUMBER);
+		}
+
+		LastSoftAngle = Soft;
+	}
+
+	// Continuous where the soft range starts
+	const float Boundary = Solver.minAngle + Solver.softClampRange;
+	Solver.offsetAngle += Boundary - RawLow;
+	Solver.clampElbowAngle = true;
+	TestEqual(TEXT("Soft clamp is continuous at the start of its range"), Solver.GetElbowTargetAngle(LowAnglePos, false), Boundary, KINDA_SMALL_NUMBER * 10.f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FArmSolverBatchParityTest, "VRExpansionPlugin.ArmSolver.BatchParity", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FArmSolverBatchParityTest::RunTest(const FString & Parameters)
+{
+	using namespace ArmSolverTestStatics;
+
+	ArmSolver Solver;
+	FArmSolverBatch Batch;
+	FillBatch(Batch, 64, 0x41524D53);
+
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bParallel = Pass == 1;
+		Solver.SolveBatch(Batch, bParallel);
+
+		TestEqual(TEXT("Batch writes an output per arm"), Batch.ElbowLocations.Num(), Batch.Num());
+
+		int32 NumMismatched = 0;
+		for (int32 i = 0; i < Batch.Num(); ++i)
+		{
+			FArmSolverResult Result;
+			Solver.SolveArm(FTransform(Batch.HMDRotations[i], Batch.HMDLocations[i]), FTransform(Batch.ControllerRotations[i], Batch.ControllerLocations[i]), Batch.IsLeftArm[i], Result);
+
+			if (!Result.ElbowLocation.Equals(Batch.ElbowLocations[i], KINDA_SMALL_NUMBER) ||
+				!Result.WristLocation.Equals(Batch.WristLocations[i], KINDA_SMALL_NUMBER) ||
+				!Result.UpperArmRotation.Equals(Batch.UpperArmRotations[i], KINDA_SMALL_NUMBER) ||
+				!Result.LowerArmRotation.Equals(Batch.LowerArmRotations[i], KINDA_SMALL_NUMBER) ||
+				!Result.HandRotation.Equals(Batch.HandRotations[i], KINDA_SMALL_NUMBER))
+			{
+				++NumMismatched;
+			}
+		}
+
+		TestEqual(bParallel ? TEXT("Parallel batch matches SolveArm") : TEXT("Batch matches SolveArm"), NumMismatched, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkArmSolverTest, "VRExpansionPlugin.Benchmark.ArmSolver", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkArmSolverTest::RunTest(const FString & Parameters)
+{
+	ArmSolver Solver;
+	FArmSolverBatch Batch;
+
+	// HMDs wander the room with the hands moving relative to them
+	FVRBenchmarkPoseStream HMDStream(FVector(0.f, 0.f, 170.f), 30.f);
+	FVRBenchmarkPoseStream HandStream(FVector(30.f, 0.f, -40.f), 20.f);
+
+	const int32 NumAvatars = FMath::Max(VRBenchmarkCvars::Avatars, 1);
+	const int32 NumWarmup = FMath::Max(VRBenchmarkCvars::WarmupFrames, 0);
+	const int32 NumFrames = NumWarmup + FMath::Max(VRBenchmarkCvars::Frames, 1);
+
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bParallel = Pass == 1;
+		const FString Config = FString::Printf(TEXT("Avatars=%d Poses=%s"), NumAvatars, HMDStream.IsRecorded() ? *FPaths::GetCleanFilename(VRBenchmarkCvars::PoseFile) : TEXT("Scripted"));
+		FVRBenchmarkRecorder Recorder(bParallel ? TEXT("ArmSolverParallel") : TEXT("ArmSolver"), Config);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const bool bRecord = Frame >= NumWarmup;
+			if (bRecord)
+				Recorder.BeginFrame();
+
+			// Filling the batch is part of the cost, its what an anim update would do every frame
+			Batch.Reset(NumAvatars * 2);
+			for (int32 i = 0; i < NumAvatars; ++i)
+			{
+				const FTransform HMD = HMDStream.GetPose(Frame, i) * FTransform(FVector((i % 8) * 300.f, (i / 8) * 300.f, 0.f));
+				Batch.AddAvatar(HMD, HandStream.GetPose(Frame, i * 2) * HMD, HandStream.GetPose(Frame, i * 2 + 1) * HMD);
+			}
+
+			Solver.SolveBatch(Batch, bParallel);
+
+			if (bRecord)
+				Recorder.EndFrame();
+		}
+
+		Recorder.Report(*this);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,159 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grippables/GrippablePhysicsReplication.h"
+#include "Grippables/GrippableCore.h"
+#include "Grippables/GrippableStaticMeshActor.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/NetworkGuid.h"
+#include "Serialization/BitWriter.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace ClientAuthThrowTestStatics
+{
+	// A thrown object mid flight, somewhere in a room sized play space
+	static FRepMovementVR MakeThrowMovement(FRandomStream & Stream)
+	{
+		FRepMovementVR Movement;
+		Movement.Location = FVector(Stream.FRandRange(-500.f, 500.f), Stream.FRandRange(-500.f, 500.f), Stream.FRandRange(0.f, 250.f));
+		Movement.Rotation = FRotator(Stream.FRandRange(-90.f, 90.f), Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-180.f, 180.f));
+		Movement.LinearVelocity = Stream.VRand() * Stream.FRandRange(100.f, 1500.f);
+		Movement.AngularVelocity = Stream.VRand() * Stream.FRandRange(0.f, 720.f);
+		Movement.bRepPhysics = true;
+		return Movement;
+	}
+
+	static int64 GetMovementBits(const FRepMovementVR & Movement)
+	{
+		FRepMovementVR Copy = Movement;
+		FBitWriter Writer(0, true);
+		bool bOutSuccess = false;
+		Copy.NetSerialize(Writer, nullptr, bOutSuccess);
+		return Writer.GetNumBits();
+	}
+
+	// Parameter bits of one batched RPC, object references are written as the packed NetGUID the package map sends for an already known actor
+	static int64 GetBatchBits(const TArray<FVRClientAuthThrowRep> & Batch, int32 FirstGUID)
+	{
+		FBitWriter Writer(0, true);
+
+		uint32 NumThrows = Batch.Num();
+		Writer.SerializeIntPacked(NumThrows);
+
+		for (int32 i = 0; i < Batch.Num(); ++i)
+		{
+			FNetworkGUID ActorGUID((FirstGUID + i) * 2);
+			Writer << ActorGUID;
+
+			FRepMovementVR Copy = Batch[i].Movement;
+			bool bOutSuccess = false;
+			Copy.NetSerialize(Writer, nullptr, bOutSuccess);
+		}
+
+		return Writer.GetNumBits();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRClientAuthThrowBatchingTest, "VRExpansionPlugin.Replication.ClientAuthThrowBatching", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRClientAuthThrowBatchingTest::RunTest(const FString & Parameters)
+{
+	using namespace ClientAuthThrowTestStatics;
+
+	FRandomStream Stream(29);
+
+	// Ten simultaneous throws from one client
+	{
+		const int32 NumThrows = 10;
+
+		TArray<FVRClientAuthThrowRep> PendingThrows;
+		int64 PerObjectBits = 0;
+		for (int32 i = 0; i < NumThrows; ++i)
+		{
+			PendingThrows.Emplace(nullptr, MakeThrowMovement(Stream));
+
+			// Without batching each object sends its own Server_GetClientAuthRepliction with just the movement
+			PerObjectBits += GetMovementBits(PendingThrows.Last().Movement);
+		}
+
+		int32 NumRPCs = 0;
+		int64 BatchedBits = 0;
+		FReplicationBucketContainer::BatchClientAuthThrows(PendingThrows, [&](const TArray<FVRClientAuthThrowRep> & Batch)
+		{
+			++NumRPCs;
+			BatchedBits += GetBatchBits(Batch, 100);
+		});
+
+		TestEqual(TEXT("Ten throws go out in one RPC"), NumRPCs, 1);
+		TestTrue(TEXT("Batched payload carries every throw"), BatchedBits > PerObjectBits);
+
+		// Each RPC also pays its own bunch header and function handle, which batching only pays once
+		AddInfo(FString::Printf(TEXT("%d throws: per object %d RPCs, %lld parameter bits | batched %d RPC, %lld parameter bits (%lld bits per throw)"),
+			NumThrows, NumThrows, PerObjectBits, NumRPCs, BatchedBits, BatchedBits / NumThrows));
+	}
+
+	// Large batches are split to stay under what the server accepts
+	{
+		const int32 NumThrows = VR_MAX_CLIENT_AUTH_THROWS_PER_RPC + 8;
+
+		TArray<FVRClientAuthThrowRep> PendingThrows;
+		for (int32 i = 0; i < NumThrows; ++i)
+			PendingThrows.Emplace(nullptr, MakeThrowMovement(Stream));
+
+		TArray<int32> BatchSizes;
+		FReplicationBucketContainer::BatchClientAuthThrows(PendingThrows, [&](const TArray<FVRClientAuthThrowRep> & Batch)
+		{
+			BatchSizes.Add(Batch.Num());
+		});
+
+		TestEqual(TEXT("Oversized update is split into two RPCs"), BatchSizes.Num(), 2);
+		if (BatchSizes.Num() == 2)
+		{
+			TestEqual(TEXT("First batch is full"), BatchSizes[0], VR_MAX_CLIENT_AUTH_THROWS_PER_RPC);
+			TestEqual(TEXT("Second batch has the rest"), BatchSizes[1], 8);
+		}
+	}
+
+	// Nothing pending, nothing sent
+	{
+		int32 NumRPCs = 0;
+		FReplicationBucketContainer::BatchClientAuthThrows(TArray<FVRClientAuthThrowRep>(), [&](const TArray<FVRClientAuthThrowRep> & Batch) { ++NumRPCs; });
+		TestEqual(TEXT("No RPC without throws"), NumRPCs, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRClientAuthThrowTimeoutTest, "VRExpansionPlugin.Replication.ClientAuthThrowTimeout", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRClientAuthThrowTimeoutTest::RunTest(const FString & Parameters)
+{
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	AGrippableStaticMeshActor * Grippable = World->SpawnActor<AGrippableStaticMeshActor>(AGrippableStaticMeshActor::StaticClass(), FTransform::Identity);
+	if (!TestNotNull(TEXT("Grippable spawned"), Grippable))
+		return false;
+
+	// A throw that has been going for longer than the timeout
+	FVRClientAuthReplicationData & ClientAuthData = Grippable->ClientAuthReplicationData;
+	ClientAuthData.bIsCurrentlyClientAuth = true;
+	ClientAuthData.ThrowingState = MakeUnique<FVRClientAuthThrowingState>();
+	ClientAuthData.ThrowingState->TimeAtInitialThrow = World->GetTimeSeconds() - 11.0f;
+
+	int32 NumSent = 0;
+	const bool bKeepPolling = FVRGrippableCore::PollClientAuthThrow(Grippable, ClientAuthData, true, [&](const FRepMovementVR & MovementRep) { ++NumSent; });
+
+	TestFalse(TEXT("Timed out throw stops polling"), bKeepPolling);
+	TestEqual(TEXT("Timed out throw sends nothing"), NumSent, 0);
+	TestFalse(TEXT("Timed out throw is no longer client authed"), ClientAuthData.bIsCurrentlyClientAuth);
+	TestFalse(TEXT("Timed out throw frees its throwing state"), ClientAuthData.ThrowingState.IsValid());
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,150 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRAIController.h"
+#include "VRCharacter.h"
+#include "Components/BoxComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRAIControllerTestStatics
+{
+	// Something to hide behind
+	static void SpawnWall(UWorld * World, const FVector & Location, float Yaw)
+	{
+		AActor * Wall = World->SpawnActor<AActor>();
+		UBoxComponent * WallBox = NewObject<UBoxComponent>(Wall);
+		WallBox->SetBoxExtent(FVector(50.f, 300.f, 200.f));
+		WallBox->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		WallBox->SetMobility(EComponentMobility::Static);
+		WallBox->SetWorldLocationAndRotation(Location, FRotator(0.f, Yaw, 0.f));
+		Wall->SetRootComponent(WallBox);
+		WallBox->RegisterComponent();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRAILineOfSightCacheTest, "VRExpansionPlugin.AI.LineOfSightCache", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRAILineOfSightCacheTest::RunTest(const FString & Parameters)
+{
+	using namespace VRAIControllerTestStatics;
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	BenchWorld.SpawnFloor();
+
+	const int32 NumViewers = 40;
+	const int32 NumTargets = 8;
+	const int32 QueriesPerFrame = 3;
+	const int32 NumFrames = 270;
+	const int32 FramesPerWaypoint = 30;
+	const float DeltaTime = 1.f / 90.f;
+
+	FRandomStream Stream(43);
+
+	for (int32 i = 0; i < 6; ++i)
+	{
+		const float Angle = Stream.FRandRange(0.f, 2.f * PI);
+		SpawnWall(World, FVector(FMath::Cos(Angle) * 1100.f, FMath::Sin(Angle) * 1100.f, 200.f), FMath::RadiansToDegrees(Angle));
+	}
+
+	// The players, held in place between waypoints so nothing drifts within the tolerance
+	TArray<AVRCharacter*> Targets;
+	for (int32 i = 0; i < NumTargets; ++i)
+	{
+		AVRCharacter * Target = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FTransform(FVector(i * 200.f, 0.f, 100.f)));
+		if (!Target)
+		{
+			AddError(TEXT("Failed to spawn a target character"));
+			return false;
+		}
+
+		Target->GetCharacterMovement()->SetComponentTickEnabled(false);
+		Targets.Add(Target);
+	}
+
+	// Every viewer asks the cached and the uncached controller the same questions
+	TArray<FVector> ViewPoints;
+	TArray<AVRAIController*> CachedControllers;
+	TArray<AVRAIController*> UncachedControllers;
+	for (int32 i = 0; i < NumViewers; ++i)
+	{
+		const float Angle = (2.f * PI * i) / NumViewers;
+		ViewPoints.Add(FVector(FMath::Cos(Angle) * 1500.f, FMath::Sin(Angle) * 1500.f, 170.f));
+
+		AVRAIController * Cached = World->SpawnActor<AVRAIController>();
+		AVRAIController * Uncached = World->SpawnActor<AVRAIController>();
+		if (!Cached || !Uncached)
+		{
+			AddError(TEXT("Failed to spawn the AI controllers"));
+			return false;
+		}
+
+		Cached->bUseLineOfSightCache = true;
+		CachedControllers.Add(Cached);
+		UncachedControllers.Add(Uncached);
+	}
+
+	int32 NumQueries = 0;
+	int32 NumMismatches = 0;
+	int32 NumVisible = 0;
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		if (Frame % FramesPerWaypoint == 0)
+		{
+			for (AVRCharacter * Target : Targets)
+			{
+				const FVector Waypoint(Stream.FRandRange(-800.f, 800.f), Stream.FRandRange(-800.f, 800.f), 100.f);
+				Target->SetActorLocation(Waypoint, false, nullptr, ETeleportType::TeleportPhysics);
+			}
+		}
+
+		World->Tick(LEVELTICK_All, DeltaTime);
+
+		// Behavior tree, focus and an EQS test all asking the same thing
+		for (int32 Query = 0; Query < QueriesPerFrame; ++Query)
+		{
+			for (int32 ViewerIndex = 0; ViewerIndex < NumViewers; ++ViewerIndex)
+			{
+				for (AVRCharacter * Target : Targets)
+				{
+					const bool bCached = CachedControllers[ViewerIndex]->LineOfSightTo(Target, ViewPoints[ViewerIndex]);
+					const bool bUncached = UncachedControllers[ViewerIndex]->LineOfSightTo(Target, ViewPoints[ViewerIndex]);
+
+					++NumQueries;
+					NumMismatches += bCached != bUncached ? 1 : 0;
+					NumVisible += bUncached ? 1 : 0;
+				}
+			}
+		}
+	}
+
+	int32 CachedTraces = 0;
+	int32 UncachedTraces = 0;
+	int32 CacheHits = 0;
+	for (int32 i = 0; i < NumViewers; ++i)
+	{
+		CachedTraces += CachedControllers[i]->NumLineOfSightTraces;
+		UncachedTraces += UncachedControllers[i]->NumLineOfSightTraces;
+		CacheHits += CachedControllers[i]->NumLineOfSightCacheHits;
+	}
+
+	TestTrue(TEXT("Scene has both visible and hidden targets"), NumVisible > 0 && NumVisible < NumQueries);
+	TestEqual(TEXT("Cached answers match the traced ones"), NumMismatches, 0);
+	TestTrue(TEXT("Cache saves traces"), CachedTraces < UncachedTraces);
+
+	const float SimulatedSeconds = NumFrames * DeltaTime;
+	AddInfo(FString::Printf(TEXT("%d viewers x %d targets x %d queries per frame: %d queries, %d cache hits | traces per second %.0f uncached, %.0f cached (%d saved)"),
+		NumViewers, NumTargets, QueriesPerFrame, NumQueries, CacheHits, UncachedTraces / SimulatedSeconds, CachedTraces / SimulatedSeconds, UncachedTraces - CachedTraces));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
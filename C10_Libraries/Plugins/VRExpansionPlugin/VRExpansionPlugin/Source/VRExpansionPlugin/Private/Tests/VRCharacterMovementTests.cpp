@@ -0,0 +1,436 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRBaseCharacterMovementComponent.h"
+#include "VRCharacterMovementComponent.h"
+#include "VRCharacter.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/NetworkGuid.h"
+#include "Serialization/BitWriter.h"
+#include "Serialization/BitReader.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRCharacterMovementTestStatics
+{
+	// Typical correction, a few cm to a meter off and walking speed
+	static FVRCompactClientAdjustment MakeAdjustment(FRandomStream & Stream, bool bWithVelocity)
+	{
+		FVRCompactClientAdjustment Adjustment;
+		Adjustment.LocationOffset = Stream.VRand() * Stream.FRandRange(0.5f, 100.f);
+		Adjustment.NewVelocity = bWithVelocity ? Stream.VRand() * Stream.FRandRange(10.f, 600.f) : FVector::ZeroVector;
+		Adjustment.NewYaw = FRotator::CompressAxisToShort(Stream.FRandRange(0.f, 360.f));
+		Adjustment.ServerMovementMode = (uint8)Stream.RandRange(0, MOVE_MAX - 1);
+		return Adjustment;
+	}
+
+	// Parameters of ClientAdjustPositionVR for the same correction with no base, the path the compact one replaces
+	// The bone name goes through the package map so it isn't counted, this undercounts the full adjustment a little
+	static int64 GetFullAdjustmentBits(const FVRCompactClientAdjustment & Adjustment)
+	{
+		FBitWriter Writer(0, true);
+
+		FVector NewLoc = FVector(1200.f, -340.f, 90.f) + Adjustment.LocationOffset;
+		FVector NewVel = Adjustment.NewVelocity;
+		uint16 NewYaw = Adjustment.NewYaw;
+		FNetworkGUID NewBase;
+		bool bHasBase = false;
+		bool bBaseRelativePosition = false;
+		uint8 ServerMovementMode = Adjustment.ServerMovementMode;
+
+		Writer << NewLoc << NewVel << NewYaw << NewBase;
+		Writer.WriteBit(bHasBase);
+		Writer.WriteBit(bBaseRelativePosition);
+		Writer << ServerMovementMode;
+
+		return Writer.GetNumBits();
+	}
+
+	struct FTracedRepulsion
+	{
+		bool bApplied;
+		bool bStopBody;
+		FVector ForceCenter;
+
+		// Placements this close to a threshold can go either way on float error, they are skipped
+		bool bAmbiguous;
+	};
+
+	// ApplyRepulsionForce as it was before the hit was solved analytically, one trace against the capsule per body
+	static FTracedRepulsion GetTracedRepulsion(UCapsuleComponent * Capsule, const FVector & BodyLocation, const FVector & BodyVelocity, float DeltaSeconds)
+	{
+		FCollisionQueryParams QueryParams;
+		QueryParams.bReturnFaceIndex = false;
+		QueryParams.bReturnPhysicalMaterial = false;
+
+		float CapsuleRadius = 0.f;
+		float CapsuleHalfHeight = 0.f;
+		Capsule->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+		const float StopBodyDistance = 2.5f;
+		const FVector MyLocation = Capsule->GetComponentLocation();
+
+		FHitResult Hit;
+		bool bHasHit = Capsule->LineTraceComponent(Hit, BodyLocation, FVector(MyLocation.X, MyLocation.Y, BodyLocation.Z), QueryParams);
+
+		FVector HitLoc = Hit.ImpactPoint;
+		bool bIsPenetrating = Hit.bStartPenetrating || Hit.PenetrationDepth > StopBodyDistance;
+
+		if (!bHasHit)
+		{
+			HitLoc = BodyLocation;
+			bIsPenetrating = true;
+		}
+
+		const float DistanceNow = (HitLoc - BodyLocation).SizeSquared2D();
+		const float DistanceLater = (HitLoc - (BodyLocation + BodyVelocity * DeltaSeconds)).SizeSquared2D();
+
+		const FVector CylinderOffset(0.f, 0.f, FMath::Max(CapsuleHalfHeight - CapsuleRadius, 0.f));
+		const float SurfaceDistance = FMath::PointDistToSegment(BodyLocation, MyLocation - CylinderOffset, MyLocation + CylinderOffset) - CapsuleRadius;
+
+		FTracedRepulsion Result;
+		Result.bApplied = false;
+		Result.bStopBody = false;
+		Result.ForceCenter = MyLocation;
+		Result.bAmbiguous = FMath::Abs(SurfaceDistance) < 0.1f || FMath::Abs(FMath::Abs(BodyLocation.Z - MyLocation.Z) - CapsuleHalfHeight) < 0.1f ||
+			(!bIsPenetrating && (FMath::Abs(FMath::Sqrt(DistanceNow) - FMath::Sqrt(StopBodyDistance)) < 0.05f || FMath::Abs(DistanceLater - DistanceNow) < 0.05f));
+
+		if (bHasHit && DistanceNow < StopBodyDistance && !bIsPenetrating)
+		{
+			Result.bApplied = true;
+			Result.bStopBody = true;
+		}
+		else if (DistanceLater <= DistanceNow || bIsPenetrating)
+		{
+			Result.bApplied = true;
+
+			if (bHasHit)
+			{
+				Result.ForceCenter.Z = HitLoc.Z;
+			}
+			else
+			{
+				Result.ForceCenter.Z = FMath::Clamp(BodyLocation.Z, MyLocation.Z - CapsuleHalfHeight, MyLocation.Z + CapsuleHalfHeight);
+			}
+		}
+
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRCompactClientAdjustmentSerializeTest, "VRExpansionPlugin.CharacterMovement.CompactClientAdjustmentSerialize", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRCompactClientAdjustmentSerializeTest::RunTest(const FString & Parameters)
+{
+	using namespace VRCharacterMovementTestStatics;
+
+	FRandomStream Stream(35);
+
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bWithVelocity = Pass == 0;
+		const int32 NumAdjustments = 1000;
+
+		int64 CompactBits = 0;
+		int64 FullBits = 0;
+		int32 NumFailed = 0;
+		float MaxLocationError = 0.f;
+		float MaxVelocityError = 0.f;
+
+		for (int32 i = 0; i < NumAdjustments; ++i)
+		{
+			FVRCompactClientAdjustment Sent = MakeAdjustment(Stream, bWithVelocity);
+
+			FBitWriter Writer(0, true);
+			bool bWriteSuccess = false;
+			Sent.NetSerialize(Writer, nullptr, bWriteSuccess);
+			CompactBits += Writer.GetNumBits();
+			FullBits += GetFullAdjustmentBits(Sent);
+
+			// Garbage in the received struct so a field that isn't read shows up
+			FVRCompactClientAdjustment Received;
+			Received.LocationOffset = FVector(-1.f);
+			Received.NewVelocity = FVector(-1.f);
+
+			FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+			bool bReadSuccess = false;
+			Received.NetSerialize(Reader, nullptr, bReadSuccess);
+
+			if (!bWriteSuccess || !bReadSuccess || Reader.IsError() || Received.NewYaw != Sent.NewYaw || Received.ServerMovementMode != Sent.ServerMovementMode)
+				++NumFailed;
+
+			MaxLocationError = FMath::Max(MaxLocationError, (Received.LocationOffset - Sent.LocationOffset).GetAbsMax());
+			MaxVelocityError = FMath::Max(MaxVelocityError, (Received.NewVelocity - Sent.NewVelocity).GetAbsMax());
+		}
+
+		const FString Context = bWithVelocity ? TEXT("Moving") : TEXT("Stopped");
+
+		TestEqual(*(Context + TEXT(": every adjustment round trips")), NumFailed, 0);
+
+		// Quantized to 0.01 and 0.1
+		TestTrue(*(Context + TEXT(": location offset within its quantization")), MaxLocationError <= 0.005f + KINDA_SMALL_NUMBER);
+		TestTrue(*(Context + TEXT(": velocity within its quantization")), MaxVelocityError <= 0.05f + KINDA_SMALL_NUMBER);
+		TestTrue(*(Context + TEXT(": compact adjustment is smaller than the full one")), CompactBits < FullBits);
+
+		AddInfo(FString::Printf(TEXT("%s: compact %.1f bits per adjustment vs %.1f bits for ClientAdjustPositionVR parameters, max error location %.4f velocity %.4f"),
+			*Context, (double)CompactBits / NumAdjustments, (double)FullBits / NumAdjustments, MaxLocationError, MaxVelocityError));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRRepulsionMatchesTraceTest, "VRExpansionPlugin.CharacterMovement.RepulsionMatchesTrace", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRRepulsionMatchesTraceTest::RunTest(const FString & Parameters)
+{
+	using namespace VRCharacterMovementTestStatics;
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	AActor * Actor = World->SpawnActor<AActor>();
+	UCapsuleComponent * Capsule = NewObject<UCapsuleComponent>(Actor);
+	Capsule->SetMobility(EComponentMobility::Movable);
+	Capsule->InitCapsuleSize(40.f, 90.f);
+	Capsule->SetCollisionProfileName(UCollisionProfile::Pawn_ProfileName);
+	Capsule->SetWorldLocation(FVector(120.f, -60.f, 90.f));
+	Actor->SetRootComponent(Capsule);
+	Capsule->RegisterComponent();
+
+	float CapsuleRadius = 0.f;
+	float CapsuleHalfHeight = 0.f;
+	Capsule->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+	const FVector CapsuleLocation = Capsule->GetComponentLocation();
+	const float DeltaSeconds = 1.f / 90.f;
+
+	// Bodies around, inside, above and below the capsule, moving in random directions
+	FRandomStream Stream(34);
+	TArray<FVector> BodyLocations;
+	TArray<FVector> BodyVelocities;
+	for (int32 i = 0; i < 5000; ++i)
+	{
+		BodyLocations.Add(CapsuleLocation + FVector(Stream.FRandRange(-1.5f, 1.5f) * CapsuleRadius, Stream.FRandRange(-1.5f, 1.5f) * CapsuleRadius, Stream.FRandRange(-1.2f, 1.2f) * CapsuleHalfHeight));
+		BodyVelocities.Add(Stream.VRand() * Stream.FRandRange(0.f, 300.f));
+	}
+
+	int32 NumCompared = 0;
+	int32 NumApplied = 0;
+	int32 NumDecisionMismatches = 0;
+	float MaxForceCenterError = 0.f;
+
+	for (int32 i = 0; i < BodyLocations.Num(); ++i)
+	{
+		const FTracedRepulsion Traced = GetTracedRepulsion(Capsule, BodyLocations[i], BodyVelocities[i], DeltaSeconds);
+		if (Traced.bAmbiguous)
+			continue;
+
+		FVector ForceCenter;
+		bool bStopBody = false;
+		const bool bApplied = UVRCharacterMovementComponent::GetRepulsionForceCenter(CapsuleLocation, CapsuleRadius, CapsuleHalfHeight, BodyLocations[i], BodyVelocities[i], DeltaSeconds, ForceCenter, bStopBody);
+
+		++NumCompared;
+		if (bApplied != Traced.bApplied || bStopBody != Traced.bStopBody)
+		{
+			++NumDecisionMismatches;
+			continue;
+		}
+
+		if (bApplied)
+		{
+			++NumApplied;
+			if (!bStopBody)
+				MaxForceCenterError = FMath::Max(MaxForceCenterError, FVector::Dist(ForceCenter, Traced.ForceCenter));
+		}
+	}
+
+	TestTrue(TEXT("Most placements are compared"), NumCompared > BodyLocations.Num() * 9 / 10);
+	TestTrue(TEXT("Placements exercise the force path"), NumApplied > 0);
+	TestEqual(TEXT("Analytic hit pushes or stops the same bodies as the trace"), NumDecisionMismatches, 0);
+	TestTrue(TEXT("Force centers match the trace"), MaxForceCenterError < 0.01f);
+
+	// What a pile of 200 props costs per tick either way
+	const int32 NumProps = 200;
+	const int32 NumTimedFrames = 100;
+
+	double StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumTimedFrames; ++Frame)
+	{
+		for (int32 i = 0; i < NumProps; ++i)
+			GetTracedRepulsion(Capsule, BodyLocations[i], BodyVelocities[i], DeltaSeconds);
+	}
+	const double TracedMS = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumTimedFrames;
+
+	StartTime = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < NumTimedFrames; ++Frame)
+	{
+		for (int32 i = 0; i < NumProps; ++i)
+		{
+			FVector ForceCenter;
+			bool bStopBody = false;
+			UVRCharacterMovementComponent::GetRepulsionForceCenter(CapsuleLocation, CapsuleRadius, CapsuleHalfHeight, BodyLocations[i], BodyVelocities[i], DeltaSeconds, ForceCenter, bStopBody);
+		}
+	}
+	const double AnalyticMS = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumTimedFrames;
+
+	AddInfo(FString::Printf(TEXT("%d placements compared, %d pushed or stopped, max force center error %.4f | %d props per tick: traced %.4f ms, analytic %.4f ms"),
+		NumCompared, NumApplied, MaxForceCenterError, NumProps, TracedMS, AnalyticMS));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRLossyLinkReplayTest, "VRExpansionPlugin.CharacterMovement.LossyLinkReplay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// A client predicting ahead of a server that drifts from it, with the servers answers arriving late or not at all
+bool FVRLossyLinkReplayTest::RunTest(const FString & Parameters)
+{
+	const float DeltaTime = 1.f / 90.f;
+	const int32 NumFrames = 900;
+	const int32 LatencyFrames = 12;
+	const float LossChance = 0.25f;
+	const float CorrectionDistance = 2.f;
+	const FVector ServerLane(0.f, 1000.f, 0.f);
+
+	float FullReplayMaxDivergence = 0.f;
+
+	// Full replay, combined replay, combined replay that skips small corrections
+	for (int32 Pass = 0; Pass < 3; ++Pass)
+	{
+		FVRBenchmarkWorld BenchWorld;
+		UWorld * World = BenchWorld.GetWorld();
+		if (!TestNotNull(TEXT("Benchmark world"), World))
+			return false;
+
+		BenchWorld.SpawnFloor();
+
+		// The server copy walks its own lane so the two don't collide
+		AVRCharacter * Client = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FTransform(FVector(0.f, 0.f, 100.f)));
+		AVRCharacter * Server = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FTransform(FVector(0.f, 0.f, 100.f) + ServerLane));
+		UVRCharacterMovementComponent * ClientMovement = Client ? Cast<UVRCharacterMovementComponent>(Client->GetCharacterMovement()) : nullptr;
+		UVRCharacterMovementComponent * ServerMovement = Server ? Cast<UVRCharacterMovementComponent>(Server->GetCharacterMovement()) : nullptr;
+		if (!ClientMovement || !ServerMovement)
+		{
+			AddError(TEXT("Failed to spawn the replay characters"));
+			return false;
+		}
+
+		Client->SpawnDefaultController();
+		Server->SpawnDefaultController();
+
+		ClientMovement->bCombineReplayedMoves = Pass > 0;
+		ClientMovement->ReplaySkipTolerance = Pass == 2 ? 2.f : 0.f;
+
+		// The server is a little slower than the client predicts, so the client keeps getting ahead of it
+		ServerMovement->MaxWalkSpeed *= 0.97f;
+
+		struct FServerState
+		{
+			float TimeStamp;
+			FVector Location;
+			FVector Velocity;
+			uint16 Yaw;
+			UPrimitiveComponent * Base;
+			uint8 MovementMode;
+			bool bLost;
+		};
+		TArray<FServerState> ServerStates;
+
+		FNetworkPredictionData_Client_Character * ClientData = ClientMovement->GetPredictionData_Client_Character();
+		FRandomStream Stream(36);
+
+		double ReplaySeconds = 0.0;
+		int32 NumCorrections = 0;
+		int32 NumReplays = 0;
+		float MaxDivergence = 0.f;
+		float FinalDivergence = 0.f;
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			// Thumbstick locomotion in a slowly turning direction
+			const float Heading = (float)Frame * 0.005f;
+			const FVector InputDir(FMath::Cos(Heading), FMath::Sin(Heading), 0.f);
+
+			ClientData->CurrentTimeStamp += DeltaTime;
+			FSavedMovePtr Move = ClientData->CreateSavedMove();
+			Move->SetMoveFor(Client, DeltaTime, InputDir * ClientMovement->GetMaxAcceleration(), *ClientData);
+
+			Client->AddMovementInput(InputDir, 1.f);
+			Server->AddMovementInput(InputDir, 1.f);
+
+			// Now and then the server bumps into something the client never saw
+			if (Frame > 0 && Frame % 150 == 0)
+				Server->SetActorLocation(Server->GetActorLocation() + FVector(0.f, 6.f, 0.f));
+
+			World->Tick(LEVELTICK_All, DeltaTime);
+			++GFrameCounter;
+
+			Move->PostUpdate(Client, FSavedMove_Character::PostUpdate_Record);
+			ClientData->SavedMoves.Push(Move);
+
+			// Bursts of a third of a second where nothing gets through on top of the random loss
+			FServerState State;
+			State.TimeStamp = Move->TimeStamp;
+			State.Location = Server->GetActorLocation() - ServerLane;
+			State.Velocity = ServerMovement->Velocity;
+			State.Yaw = FRotator::CompressAxisToShort(Server->GetActorRotation().Yaw);
+			State.Base = Server->GetMovementBase();
+			State.MovementMode = ServerMovement->PackNetworkMovementMode();
+			State.bLost = Stream.FRand() < LossChance || (Frame % 180) < 30;
+			ServerStates.Add(State);
+
+			// The servers answer to the move sent LatencyFrames ago shows up now
+			const int32 AnswerFrame = Frame - LatencyFrames;
+			if (AnswerFrame >= 0 && !ServerStates[AnswerFrame].bLost)
+			{
+				const FServerState & Answer = ServerStates[AnswerFrame];
+				const int32 MoveIndex = ClientData->GetSavedMoveIndex(Answer.TimeStamp);
+				if (MoveIndex != INDEX_NONE)
+				{
+					if (FVector::Dist(ClientData->SavedMoves[MoveIndex]->SavedLocation, Answer.Location) > CorrectionDistance)
+					{
+						++NumCorrections;
+
+						const double StartTime = FPlatformTime::Seconds();
+						ClientMovement->ClientAdjustPositionVR_Implementation(Answer.TimeStamp, Answer.Location, Answer.Yaw, Answer.Velocity, Answer.Base, NAME_None, Answer.Base != nullptr, false, Answer.MovementMode);
+						if (ClientData->bUpdatePosition)
+							++NumReplays;
+						ClientMovement->ClientUpdatePositionAfterServerUpdate();
+						ReplaySeconds += FPlatformTime::Seconds() - StartTime;
+					}
+					else
+					{
+						ClientMovement->ClientAckGoodMove_Implementation(Answer.TimeStamp);
+					}
+				}
+			}
+
+			FinalDivergence = FVector::Dist(Client->GetActorLocation(), Server->GetActorLocation() - ServerLane);
+			MaxDivergence = FMath::Max(MaxDivergence, FinalDivergence);
+		}
+
+		const FString Context = Pass == 0 ? TEXT("Full replay") : (Pass == 1 ? TEXT("Combined replay") : TEXT("Combined replay with skips"));
+
+		if (Pass == 0)
+		{
+			FullReplayMaxDivergence = MaxDivergence;
+			TestTrue(*(Context + TEXT(": the lossy link causes corrections")), NumCorrections > 0);
+			TestEqual(*(Context + TEXT(": every correction replays")), NumReplays, NumCorrections);
+		}
+		else
+		{
+			// Coarser steps and skipped corrections can't leave the client further off than the skip tolerance allows
+			TestTrue(*(Context + TEXT(": divergence stays close to the full replay")), MaxDivergence <= FullReplayMaxDivergence + ClientMovement->ReplaySkipTolerance + 1.f);
+		}
+
+		AddInfo(FString::Printf(TEXT("%s: %d corrections, %d replayed, %.3f ms replaying (%.4f ms per correction), divergence max %.2f final %.2f"),
+			*Context, NumCorrections, NumReplays, ReplaySeconds * 1000.0, NumCorrections > 0 ? ReplaySeconds * 1000.0 / NumCorrections : 0.0, MaxDivergence, FinalDivergence));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
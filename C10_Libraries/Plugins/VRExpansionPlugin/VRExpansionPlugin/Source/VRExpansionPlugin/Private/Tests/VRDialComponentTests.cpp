@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactibles/VRDialComponent.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRDialComponentTestStatics
+{
+	struct FSlowTurnResult
+	{
+		int32 NumDialTransformUpdates;
+		int32 NumChildPropagations;
+		float FinalVisibleLag;
+		TArray<float> DialAngles;
+		TArray<float> SnapAngles;
+	};
+
+	// A dial with something attached to it (a knob mesh, a needle), turned by a small amount every frame like a slow hand would
+	static void RunSlowTurn(UWorld * World, float UpdateTolerance, int32 NumFrames, float DegreesPerFrame, float DeltaTime, FSlowTurnResult & OutResult)
+	{
+		AActor * Actor = World->SpawnActor<AActor>();
+		USceneComponent * Root = NewObject<USceneComponent>(Actor);
+		Root->SetMobility(EComponentMobility::Movable);
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+
+		UVRDialComponent * Dial = NewObject<UVRDialComponent>(Actor);
+		Dial->SetMobility(EComponentMobility::Movable);
+		Dial->SetupAttachment(Root);
+		Dial->bDialUsesAngleSnap = true;
+		Dial->SnapAngleIncrement = 45.0f;
+		Dial->SnapAngleThreshold = 2.0f;
+		Dial->DialRotationUpdateTolerance = UpdateTolerance;
+		Dial->RegisterComponent();
+
+		USceneComponent * Knob = NewObject<USceneComponent>(Actor);
+		Knob->SetMobility(EComponentMobility::Movable);
+		Knob->SetupAttachment(Dial);
+		Knob->SetRelativeLocation(FVector(5.f, 0.f, 0.f));
+		Knob->RegisterComponent();
+
+		int32 NumPropagations = 0;
+		Knob->TransformUpdated.AddLambda([&NumPropagations](USceneComponent*, EUpdateTransformFlags, ETeleportType) { ++NumPropagations; });
+
+		Dial->NumDialTransformUpdates = 0;
+		OutResult.DialAngles.Reset(NumFrames);
+		OutResult.SnapAngles.Reset(NumFrames);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Dial->AddDialAngle(DegreesPerFrame, true);
+			World->Tick(LEVELTICK_All, DeltaTime);
+
+			OutResult.DialAngles.Add(Dial->CurrentDialAngle);
+			OutResult.SnapAngles.Add(Dial->LastSnapAngle);
+		}
+
+		OutResult.NumDialTransformUpdates = Dial->NumDialTransformUpdates;
+		OutResult.NumChildPropagations = NumPropagations;
+
+		// How far the visible rotation is behind the dial angle at the end of the turn
+		const float VisibleAngle = (Dial->GetRelativeTransform().GetRelativeTransform(Dial->InitialRelativeTransform)).Rotator().Yaw;
+		OutResult.FinalVisibleLag = FMath::Abs(FMath::FindDeltaAngleDegrees(VisibleAngle, Dial->CurRotBackEnd));
+
+		Actor->Destroy();
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRDialSlowTurnTransformUpdatesTest, "VRExpansionPlugin.Interactibles.DialSlowTurnTransformUpdates", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRDialSlowTurnTransformUpdatesTest::RunTest(const FString & Parameters)
+{
+	using namespace VRDialComponentTestStatics;
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	// 90 degrees over 10 seconds, crossing the 45 and 90 degree snap angles
+	const int32 NumFrames = 900;
+	const float DegreesPerFrame = 0.1f;
+	const float DeltaTime = 1.f / 90.f;
+	const float UpdateTolerance = 1.0f;
+
+	FSlowTurnResult EveryFrame;
+	RunSlowTurn(World, 0.0f, NumFrames, DegreesPerFrame, DeltaTime, EveryFrame);
+
+	FSlowTurnResult WithTolerance;
+	RunSlowTurn(World, UpdateTolerance, NumFrames, DegreesPerFrame, DeltaTime, WithTolerance);
+
+	TestEqual(TEXT("Without a tolerance the dial updates its transform every frame"), EveryFrame.NumDialTransformUpdates, NumFrames);
+	TestTrue(TEXT("Tolerance skips most of the slow turns transform updates"), WithTolerance.NumDialTransformUpdates * 5 < EveryFrame.NumDialTransformUpdates);
+	TestTrue(TEXT("Attached components see fewer transform updates"), WithTolerance.NumChildPropagations < EveryFrame.NumChildPropagations);
+	TestTrue(TEXT("Visible rotation stays within the tolerance"), WithTolerance.FinalVisibleLag < UpdateTolerance + KINDA_SMALL_NUMBER);
+
+	// The skipped updates are visual only, the dial angle and snap events have to be the same every frame
+	int32 NumAngleMismatches = 0;
+	int32 NumSnapMismatches = 0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		NumAngleMismatches += EveryFrame.DialAngles[Frame] != WithTolerance.DialAngles[Frame] ? 1 : 0;
+		NumSnapMismatches += EveryFrame.SnapAngles[Frame] != WithTolerance.SnapAngles[Frame] ? 1 : 0;
+	}
+
+	TestEqual(TEXT("Dial angle is the same every frame"), NumAngleMismatches, 0);
+	TestEqual(TEXT("Snap angles are hit on the same frames"), NumSnapMismatches, 0);
+
+	AddInfo(FString::Printf(TEXT("%d frames at %.1f degrees per frame | tolerance 0: %d dial transform updates, %d knob propagations | tolerance %.1f: %d dial transform updates, %d knob propagations, %.2f degrees behind at the end"),
+		NumFrames, DegreesPerFrame, EveryFrame.NumDialTransformUpdates, EveryFrame.NumChildPropagations,
+		UpdateTolerance, WithTolerance.NumDialTransformUpdates, WithTolerance.NumChildPropagations, WithTolerance.FinalVisibleLag));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,1402 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/WorldSettings.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/ThreadSafeCounter64.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+#include "GripMotionControllerComponent.h"
+#include "VRCharacter.h"
+#include "VRCharacterMovementComponent.h"
+#include "VRGestureComponent.h"
+#include "ReplicatedVRCameraComponent.h"
+#include "Interactibles/VRLeverComponent.h"
+#include "Interactibles/VRSliderComponent.h"
+#include "Interactibles/VRDialComponent.h"
+#include "Interactibles/VRButtonComponent.h"
+#include "Interactibles/VRButtonPanelComponent.h"
+#include "Grippables/GrippableStaticMeshActor.h"
+#include "Grippables/GrippableCore.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVRBenchmark, Log, All);
+
+namespace VRBenchmarkCvars
+{
+	int32 Frames = 600;
+	FAutoConsoleVariableRef CVarFrames(
+		TEXT("vre.Benchmark.Frames"),
+		Frames,
+		TEXT("Recorded frames per benchmark scenario."),
+		ECVF_Default);
+
+	int32 WarmupFrames = 60;
+	FAutoConsoleVariableRef CVarWarmupFrames(
+		TEXT("vre.Benchmark.WarmupFrames"),
+		WarmupFrames,
+		TEXT("Frames ticked before recording starts in each benchmark scenario."),
+		ECVF_Default);
+
+	int32 Controllers = 16;
+	FAutoConsoleVariableRef CVarControllers(
+		TEXT("vre.Benchmark.Controllers"),
+		Controllers,
+		TEXT("Motion controllers spawned by the grip benchmark."),
+		ECVF_Default);
+
+	int32 GripsPerController = 2;
+	FAutoConsoleVariableRef CVarGripsPerController(
+		TEXT("vre.Benchmark.GripsPerController"),
+		GripsPerController,
+		TEXT("Objects held by each controller in the grip benchmark."),
+		ECVF_Default);
+
+	int32 PhysicsGrips = 0;
+	FAutoConsoleVariableRef CVarPhysicsGrips(
+		TEXT("vre.Benchmark.PhysicsGrips"),
+		PhysicsGrips,
+		TEXT("0: Grip benchmark uses sweep grips, 1: Uses physics grips (needs the engine cube mesh)."),
+		ECVF_Default);
+
+	int32 Interactibles = 32;
+	FAutoConsoleVariableRef CVarInteractibles(
+		TEXT("vre.Benchmark.Interactibles"),
+		Interactibles,
+		TEXT("Held levers, sliders and dials spawned by the interactible benchmark."),
+		ECVF_Default);
+
+	int32 Characters = 16;
+	FAutoConsoleVariableRef CVarCharacters(
+		TEXT("vre.Benchmark.Characters"),
+		Characters,
+		TEXT("VR characters spawned by the character movement benchmark."),
+		ECVF_Default);
+
+	int32 ServerMoveClients = 64;
+	FAutoConsoleVariableRef CVarServerMoveClients(
+		TEXT("vre.Benchmark.ServerMoveClients"),
+		ServerMoveClients,
+		TEXT("Simulated remote clients sending server moves in the server move benchmark."),
+		ECVF_Default);
+
+	float ServerMoveBudgetMS = 1.0f;
+	FAutoConsoleVariableRef CVarServerMoveBudgetMS(
+		TEXT("vre.Benchmark.ServerMoveBudgetMS"),
+		ServerMoveBudgetMS,
+		TEXT("vre.ServerMoveBudgetMS used for the budgeted pass of the server move benchmark."),
+		ECVF_Default);
+
+	int32 SimulatedProxies = 64;
+	FAutoConsoleVariableRef CVarSimulatedProxies(
+		TEXT("vre.Benchmark.SimulatedProxies"),
+		SimulatedProxies,
+		TEXT("Simulated proxy VR characters spawned by the proxy LOD benchmark."),
+		ECVF_Default);
+
+	int32 GestureComponents = 16;
+	FAutoConsoleVariableRef CVarGestureComponents(
+		TEXT("vre.Benchmark.GestureComponents"),
+		GestureComponents,
+		TEXT("Gesture components recording with detection in the gesture benchmark."),
+		ECVF_Default);
+
+	int32 GestureTemplates = 8;
+	FAutoConsoleVariableRef CVarGestureTemplates(
+		TEXT("vre.Benchmark.GestureTemplates"),
+		GestureTemplates,
+		TEXT("Gestures in the database the gesture benchmark matches against."),
+		ECVF_Default);
+
+	int32 Avatars = 64;
+	FAutoConsoleVariableRef CVarAvatars(
+		TEXT("vre.Benchmark.Avatars"),
+		Avatars,
+		TEXT("Avatars (two arms each) solved per frame by the arm solver benchmark."),
+		ECVF_Default);
+
+	int32 IdleGrippables = 5000;
+	FAutoConsoleVariableRef CVarIdleGrippables(
+		TEXT("vre.Benchmark.IdleGrippables"),
+		IdleGrippables,
+		TEXT("Grippable actors left lying around in the idle grippables benchmark."),
+		ECVF_Default);
+
+	int32 RepulsionProps = 200;
+	FAutoConsoleVariableRef CVarRepulsionProps(
+		TEXT("vre.Benchmark.RepulsionProps"),
+		RepulsionProps,
+		TEXT("Simulated props overlapping the character in the repulsion benchmark."),
+		ECVF_Default);
+
+	int32 PanelButtons = 256;
+	FAutoConsoleVariableRef CVarPanelButtons(
+		TEXT("vre.Benchmark.PanelButtons"),
+		PanelButtons,
+		TEXT("Buttons on the keypad in the button panel benchmark, as one panel and as individual button components."),
+		ECVF_Default);
+
+	FString PoseFile;
+	FAutoConsoleVariableRef CVarPoseFile(
+		TEXT("vre.Benchmark.PoseFile"),
+		PoseFile,
+		TEXT("Recorded pose stream to drive the benchmarks with instead of the scripted one.\n")
+		TEXT("One pose per line: X,Y,Z,Pitch,Yaw,Roll"),
+		ECVF_Default);
+
+	FString BaselineDir;
+	FAutoConsoleVariableRef CVarBaselineDir(
+		TEXT("vre.Benchmark.BaselineDir"),
+		BaselineDir,
+		TEXT("Directory holding the baseline summaries, defaults to Saved/VRExpansionBenchmarks/Baselines."),
+		ECVF_Default);
+
+	int32 WriteBaseline = 0;
+	FAutoConsoleVariableRef CVarWriteBaseline(
+		TEXT("vre.Benchmark.WriteBaseline"),
+		WriteBaseline,
+		TEXT("When on, the benchmark summaries are written as the new baseline instead of being compared against it."),
+		ECVF_Default);
+
+	float RegressionPercent = 10.0f;
+	FAutoConsoleVariableRef CVarRegressionPercent(
+		TEXT("vre.Benchmark.RegressionPercent"),
+		RegressionPercent,
+		TEXT("Percent over the baseline before a benchmark stat is reported as a regression."),
+		ECVF_Default);
+}
+
+namespace VRBenchmarkStatics
+{
+	// Forwards everything to the real allocator and counts the calls while it is installed as GMalloc
+	class FMallocCounter : public FMalloc
+	{
+	public:
+
+		FMalloc * Inner;
+		FThreadSafeCounter64 Allocations;
+		FThreadSafeCounter64 AllocatedBytes;
+
+		FMallocCounter() : Inner(nullptr) {}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			Allocations.Increment();
+			AllocatedBytes.Add(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			Allocations.Increment();
+			AllocatedBytes.Add(Count);
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void *Original, SIZE_T &SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(class FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+	};
+
+	// Never destroyed, other threads can still be inside of it after it is swapped back out
+	static FMallocCounter & GetMallocCounter()
+	{
+		static FMallocCounter * Counter = new FMallocCounter();
+		return *Counter;
+	}
+
+	static FString GetReportDir()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("VRExpansionBenchmarks");
+	}
+
+	static FString GetBaselineDir()
+	{
+		return VRBenchmarkCvars::BaselineDir.IsEmpty() ? GetReportDir() / TEXT("Baselines") : VRBenchmarkCvars::BaselineDir;
+	}
+
+	static const TCHAR * SummaryHeader = TEXT("Scenario,Config,Frames,MeanMs,P50Ms,P95Ms,MaxMs,AllocsPerFrame,BytesPerFrame");
+
+	// Columns of the summary that are compared against the baseline, with the smallest change that counts
+	struct FComparedStat
+	{
+		int32 Column;
+		const TCHAR * Name;
+		double MinimumDelta;
+	};
+
+	static const FComparedStat ComparedStats[] =
+	{
+		{ 3, TEXT("MeanMs"), 0.01 },
+		{ 5, TEXT("P95Ms"), 0.01 },
+		{ 7, TEXT("AllocsPerFrame"), 1.0 },
+	};
+}
+
+FVRBenchmarkPoseStream::FVRBenchmarkPoseStream(const FVector & InScriptedCenter, float InScriptedRadius)
+{
+	ScriptedCenter = InScriptedCenter;
+	ScriptedRadius = InScriptedRadius;
+
+	if (VRBenchmarkCvars::PoseFile.IsEmpty())
+		return;
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *VRBenchmarkCvars::PoseFile))
+	{
+		UE_LOG(LogVRBenchmark, Warning, TEXT("Couldn't load pose file %s, using scripted poses"), *VRBenchmarkCvars::PoseFile);
+		return;
+	}
+
+	TArray<FString> Values;
+	for (const FString & Line : Lines)
+	{
+		if (Line.IsEmpty() || Line.StartsWith(TEXT("#")))
+			continue;
+
+		if (Line.ParseIntoArray(Values, TEXT(","), true) < 6)
+			continue;
+
+		const FVector Location(FCString::Atof(*Values[0]), FCString::Atof(*Values[1]), FCString::Atof(*Values[2]));
+		const FRotator Rotation(FCString::Atof(*Values[3]), FCString::Atof(*Values[4]), FCString::Atof(*Values[5]));
+		RecordedPoses.Add(FTransform(Rotation, Location));
+	}
+
+	UE_LOG(LogVRBenchmark, Log, TEXT("Loaded %d poses from %s"), RecordedPoses.Num(), *VRBenchmarkCvars::PoseFile);
+}
+
+FTransform FVRBenchmarkPoseStream::GetPose(int32 Frame, int32 Instance) const
+{
+	if (RecordedPoses.Num() > 0)
+	{
+		return RecordedPoses[(Frame + Instance * 37) % RecordedPoses.Num()];
+	}
+
+	// Slow arm sized loops with some wrist rotation, at 90hz
+	const float Time = (float)Frame / 90.f + (float)Instance * 0.37f;
+
+	const FVector Location = ScriptedCenter + FVector(
+		FMath::Sin(Time * 0.5f) * ScriptedRadius * 0.3f,
+		FMath::Cos(Time * 2.f) * ScriptedRadius,
+		FMath::Sin(Time * 2.f) * ScriptedRadius);
+
+	const FRotator Rotation(FMath::Sin(Time) * 20.f, FMath::Sin(Time * 0.7f) * 45.f, FMath::Cos(Time * 1.3f) * 15.f);
+
+	return FTransform(Rotation, Location);
+}
+
+FVRBenchmarkRecorder::FVRBenchmarkRecorder(const FString & InScenario, const FString & InConfig)
+{
+	Scenario = InScenario;
+	Config = InConfig.Replace(TEXT(","), TEXT(" "));
+
+	Samples.Reserve(FMath::Max(VRBenchmarkCvars::Frames, 0));
+
+	FrameStartTime = 0.0;
+	FrameStartAllocations = 0;
+	FrameStartBytes = 0;
+
+	VRBenchmarkStatics::FMallocCounter & Counter = VRBenchmarkStatics::GetMallocCounter();
+	check(GMalloc != &Counter);
+	Counter.Inner = GMalloc;
+	GMalloc = &Counter;
+}
+
+FVRBenchmarkRecorder::~FVRBenchmarkRecorder()
+{
+	VRBenchmarkStatics::FMallocCounter & Counter = VRBenchmarkStatics::GetMallocCounter();
+	if (GMalloc == &Counter)
+	{
+		GMalloc = Counter.Inner;
+	}
+}
+
+void FVRBenchmarkRecorder::BeginFrame()
+{
+	VRBenchmarkStatics::FMallocCounter & Counter = VRBenchmarkStatics::GetMallocCounter();
+	FrameStartAllocations = Counter.Allocations.GetValue();
+	FrameStartBytes = Counter.AllocatedBytes.GetValue();
+	FrameStartTime = FPlatformTime::Seconds();
+}
+
+void FVRBenchmarkRecorder::EndFrame()
+{
+	const double EndTime = FPlatformTime::Seconds();
+	VRBenchmarkStatics::FMallocCounter & Counter = VRBenchmarkStatics::GetMallocCounter();
+
+	// Counts every thread, task graph work done for the frame is part of its cost
+	FFrameSample Sample;
+	Sample.Milliseconds = (EndTime - FrameStartTime) * 1000.0;
+	Sample.Allocations = Counter.Allocations.GetValue() - FrameStartAllocations;
+	Sample.AllocatedBytes = Counter.AllocatedBytes.GetValue() - FrameStartBytes;
+	Samples.Add(Sample);
+}
+
+void FVRBenchmarkRecorder::Report(FAutomationTestBase & Test) const
+{
+	using namespace VRBenchmarkStatics;
+
+	if (Samples.Num() == 0)
+	{
+		Test.AddError(FString::Printf(TEXT("%s recorded no frames"), *Scenario));
+		return;
+	}
+
+	FString FrameCSV = TEXT("Frame,FrameMs,Allocs,AllocBytes\n");
+	TArray<double> SortedTimes;
+	SortedTimes.Reserve(Samples.Num());
+
+	double TotalMs = 0.0;
+	double TotalAllocs = 0.0;
+	double TotalBytes = 0.0;
+	for (int32 i = 0; i < Samples.Num(); ++i)
+	{
+		const FFrameSample & Sample = Samples[i];
+		FrameCSV += FString::Printf(TEXT("%d,%.4f,%lld,%lld\n"), i, Sample.Milliseconds, Sample.Allocations, Sample.AllocatedBytes);
+
+		SortedTimes.Add(Sample.Milliseconds);
+		TotalMs += Sample.Milliseconds;
+		TotalAllocs += (double)Sample.Allocations;
+		TotalBytes += (double)Sample.AllocatedBytes;
+	}
+
+	SortedTimes.Sort();
+	const int32 NumFrames = Samples.Num();
+	const double MeanMs = TotalMs / NumFrames;
+	const double P50Ms = SortedTimes[(NumFrames - 1) / 2];
+	const double P95Ms = SortedTimes[FMath::Min(FMath::CeilToInt(NumFrames * 0.95f) - 1, NumFrames - 1)];
+	const double MaxMs = SortedTimes.Last();
+
+	const FString SummaryRow = FString::Printf(TEXT("%s,%s,%d,%.4f,%.4f,%.4f,%.4f,%.2f,%.0f"),
+		*Scenario, *Config, NumFrames, MeanMs, P50Ms, P95Ms, MaxMs, TotalAllocs / NumFrames, TotalBytes / NumFrames);
+	const FString Summary = FString(SummaryHeader) + TEXT("\n") + SummaryRow + TEXT("\n");
+
+	const FString ReportDir = GetReportDir();
+	FFileHelper::SaveStringToFile(FrameCSV, *(ReportDir / Scenario + TEXT(".csv")));
+	FFileHelper::SaveStringToFile(Summary, *(ReportDir / Scenario + TEXT("_Summary.csv")));
+
+	Test.AddInfo(SummaryRow);
+
+	const FString BaselineFile = GetBaselineDir() / Scenario + TEXT("_Summary.csv");
+	if (VRBenchmarkCvars::WriteBaseline != 0)
+	{
+		FFileHelper::SaveStringToFile(Summary, *BaselineFile);
+		Test.AddInfo(FString::Printf(TEXT("Wrote baseline %s"), *BaselineFile));
+		return;
+	}
+
+	TArray<FString> BaselineLines;
+	if (!FFileHelper::LoadFileToStringArray(BaselineLines, *BaselineFile) || BaselineLines.Num() < 2)
+	{
+		Test.AddInfo(FString::Printf(TEXT("No baseline at %s to compare against"), *BaselineFile));
+		return;
+	}
+
+	TArray<FString> Baseline;
+	TArray<FString> Current;
+	BaselineLines[1].ParseIntoArray(Baseline, TEXT(","), false);
+	SummaryRow.ParseIntoArray(Current, TEXT(","), false);
+
+	if (Baseline.Num() != Current.Num() || Baseline[1] != Config)
+	{
+		Test.AddWarning(FString::Printf(TEXT("%s baseline was recorded with a different setup (%s), not comparing"), *Scenario, Baseline.Num() > 1 ? *Baseline[1] : TEXT("unknown")));
+		return;
+	}
+
+	for (const FComparedStat & Stat : ComparedStats)
+	{
+		const double BaselineValue = FCString::Atod(*Baseline[Stat.Column]);
+		const double CurrentValue = FCString::Atod(*Current[Stat.Column]);
+		const double Allowed = FMath::Max(BaselineValue * (VRBenchmarkCvars::RegressionPercent / 100.0), Stat.MinimumDelta);
+
+		const FString Line = FString::Printf(TEXT("%s %s: %.4f -> %.4f"), *Scenario, Stat.Name, BaselineValue, CurrentValue);
+		if (CurrentValue - BaselineValue > Allowed)
+		{
+			// Timings are too noisy to fail on, leave that to whoever reads the report
+			Test.AddWarning(Line + TEXT(" regressed"));
+		}
+		else
+		{
+			Test.AddInfo(Line);
+		}
+	}
+}
+
+FVRBenchmarkWorld::FVRBenchmarkWorld()
+{
+	World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("VRExpansionBenchmark"));
+	check(World);
+
+	FWorldContext & WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	World->InitializeActorsForPlay(FURL());
+	World->BeginPlay();
+
+	// There is no game mode to start the match, this is what would set begun play and dispatch it
+	World->GetWorldSettings()->NotifyBeginPlay();
+
+	CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+}
+
+FVRBenchmarkWorld::~FVRBenchmarkWorld()
+{
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	if (World->IsRooted())
+		World->RemoveFromRoot();
+
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+}
+
+AActor * FVRBenchmarkWorld::SpawnFloor()
+{
+	AActor * Floor = World->SpawnActor<AActor>();
+	UBoxComponent * FloorBox = NewObject<UBoxComponent>(Floor);
+	FloorBox->SetBoxExtent(FVector(20000.f, 20000.f, 50.f));
+	FloorBox->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	FloorBox->SetMobility(EComponentMobility::Static);
+	FloorBox->SetWorldLocation(FVector(0.f, 0.f, -50.f));
+	Floor->SetRootComponent(FloorBox);
+	FloorBox->RegisterComponent();
+
+	return Floor;
+}
+
+void FVRBenchmarkWorld::Run(FVRBenchmarkRecorder & Recorder, TFunctionRef<void(int32 Frame)> PreTick, float DeltaTime)
+{
+	const int32 NumWarmup = FMath::Max(VRBenchmarkCvars::WarmupFrames, 0);
+	const int32 NumFrames = NumWarmup + FMath::Max(VRBenchmarkCvars::Frames, 1);
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		// Pose updates stand in for the tracking poll, they aren't part of the measured frame
+		PreTick(Frame);
+
+		const bool bRecord = Frame >= NumWarmup;
+		if (bRecord)
+			Recorder.BeginFrame();
+
+		World->Tick(LEVELTICK_All, DeltaTime);
+
+		if (bRecord)
+			Recorder.EndFrame();
+
+		// Normally the engine loop does this, some per frame caches key off of it
+		++GFrameCounter;
+	}
+}
+
+namespace VRBenchmarkStatics
+{
+	static FString GetPoseConfig(const FVRBenchmarkPoseStream & PoseStream)
+	{
+		return PoseStream.IsRecorded() ? FPaths::GetCleanFilename(VRBenchmarkCvars::PoseFile) : FString(TEXT("Scripted"));
+	}
+
+	// Empty actor with a scene root for components to hang off of
+	static USceneComponent * SpawnRootActor(UWorld * World, const FVector & Location)
+	{
+		AActor * Actor = World->SpawnActor<AActor>();
+		USceneComponent * Root = NewObject<USceneComponent>(Actor);
+		Root->SetMobility(EComponentMobility::Movable);
+		Root->SetWorldLocation(Location);
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+		return Root;
+	}
+
+	template<class ComponentType>
+	static ComponentType * AddBenchmarkComponent(USceneComponent * Parent, const FTransform & RelativeTransform = FTransform::Identity)
+	{
+		ComponentType * Component = NewObject<ComponentType>(Parent->GetOwner());
+		Component->SetMobility(EComponentMobility::Movable);
+		Component->SetupAttachment(Parent);
+		Component->SetRelativeTransform(RelativeTransform);
+		Component->RegisterComponent();
+		return Component;
+	}
+
+	// Simple 2D shapes in the YZ plane, roughly the size of a database gesture
+	static FVRGesture MakeBenchmarkGesture(int32 Index, int32 NumSamples)
+	{
+		FVRGesture Gesture;
+		Gesture.Name = FString::Printf(TEXT("Gesture_%d"), Index);
+		Gesture.GestureType = (uint8)Index;
+
+		const float Turns = 0.5f + (float)(Index % 4) * 0.25f;
+		const float Wobble = (float)(Index / 4) * 0.5f;
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			const float Alpha = (float)i / (float)(NumSamples - 1);
+			const float Angle = Alpha * Turns * 2.f * PI;
+			Gesture.Samples.Add(FVector(0.f, FMath::Cos(Angle) * 50.f, FMath::Sin(Angle) * 50.f + FMath::Sin(Alpha * 6.f * PI) * Wobble * 10.f));
+		}
+
+		return Gesture;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkGripsTest, "VRExpansionPlugin.Benchmark.Grips", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkGripsTest::RunTest(const FString & Parameters)
+{
+	using namespace VRBenchmarkStatics;
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	FVRBenchmarkPoseStream PoseStream;
+
+	// Physics grips need a body to constrain
+	const bool bPhysicsGrips = VRBenchmarkCvars::PhysicsGrips != 0 && BenchWorld.GetCubeMesh() != nullptr;
+	if (VRBenchmarkCvars::PhysicsGrips != 0 && !bPhysicsGrips)
+	{
+		AddWarning(TEXT("Engine cube mesh not found, using sweep grips"));
+	}
+
+	TArray<UGripMotionControllerComponent*> Controllers;
+	for (int32 i = 0; i < VRBenchmarkCvars::Controllers; ++i)
+	{
+		USceneComponent * Origin = SpawnRootActor(World, FVector((i % 8) * 200.f, (i / 8) * 200.f, 0.f));
+
+		UGripMotionControllerComponent * Controller = AddBenchmarkComponent<UGripMotionControllerComponent>(Origin, PoseStream.GetPose(0, i));
+		Controller->bUseWithoutTracking = true;
+		Controllers.Add(Controller);
+
+		for (int32 GripIndex = 0; GripIndex < VRBenchmarkCvars::GripsPerController; ++GripIndex)
+		{
+			const FTransform GripOffset(FVector(10.f + GripIndex * 15.f, 0.f, 0.f));
+
+			AActor * GrippedActor = World->SpawnActor<AActor>();
+			UStaticMeshComponent * Mesh = NewObject<UStaticMeshComponent>(GrippedActor);
+			Mesh->SetMobility(EComponentMobility::Movable);
+			Mesh->SetStaticMesh(BenchWorld.GetCubeMesh());
+			Mesh->SetCollisionProfileName(UCollisionProfile::PhysicsActor_ProfileName);
+			Mesh->SetWorldTransform(FTransform(FQuat::Identity, (GripOffset * Controller->GetComponentTransform()).GetLocation(), FVector(0.1f)));
+			GrippedActor->SetRootComponent(Mesh);
+			Mesh->RegisterComponent();
+
+			if (bPhysicsGrips)
+				Mesh->SetSimulatePhysics(true);
+
+			const bool bGripped = Controller->GripComponent(Mesh, GripOffset, true, NAME_None, NAME_None,
+				bPhysicsGrips ? EGripCollisionType::InteractiveCollisionWithPhysics : EGripCollisionType::InteractiveCollisionWithSweep);
+			TestTrue(TEXT("Benchmark grip was accepted"), bGripped);
+		}
+	}
+
+	const FString Config = FString::Printf(TEXT("Controllers=%d GripsPerController=%d Physics=%d Poses=%s"), VRBenchmarkCvars::Controllers, VRBenchmarkCvars::GripsPerController, bPhysicsGrips ? 1 : 0, *GetPoseConfig(PoseStream));
+	FVRBenchmarkRecorder Recorder(TEXT("Grips"), Config);
+
+	BenchWorld.Run(Recorder, [&](int32 Frame)
+	{
+		for (int32 i = 0; i < Controllers.Num(); ++i)
+			Controllers[i]->SetRelativeTransform(PoseStream.GetPose(Frame, i));
+	});
+
+	Recorder.Report(*this);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkInteractiblesTest, "VRExpansionPlugin.Benchmark.Interactibles", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkInteractiblesTest::RunTest(const FString & Parameters)
+{
+	using namespace VRBenchmarkStatics;
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+
+	// Small hand movements around the grip point so the interactibles stay within their ranges
+	FVRBenchmarkPoseStream PoseStream(FVector::ZeroVector, 8.f);
+
+	TArray<UGripMotionControllerComponent*> Controllers;
+	TArray<FTransform> ControllerOrigins;
+	for (int32 i = 0; i < VRBenchmarkCvars::Interactibles; ++i)
+	{
+		USceneComponent * Origin = SpawnRootActor(World, FVector((i % 8) * 200.f, (i / 8) * 200.f, 100.f));
+
+		UStaticMeshComponent * Interactible = nullptr;
+		switch (i % 3)
+		{
+		case 0: Interactible = AddBenchmarkComponent<UVRLeverComponent>(Origin); break;
+		case 1: Interactible = AddBenchmarkComponent<UVRSliderComponent>(Origin); break;
+		default: Interactible = AddBenchmarkComponent<UVRDialComponent>(Origin); break;
+		}
+		Interactible->SetStaticMesh(BenchWorld.GetCubeMesh());
+
+		const FTransform HandOrigin(FVector(0.f, 0.f, 10.f));
+		UGripMotionControllerComponent * Controller = AddBenchmarkComponent<UGripMotionControllerComponent>(Origin, HandOrigin);
+		Controller->bUseWithoutTracking = true;
+
+		TestTrue(TEXT("Benchmark interactible was gripped"), Controller->GripObjectByInterface(Interactible, Interactible->GetComponentTransform()));
+
+		Controllers.Add(Controller);
+		ControllerOrigins.Add(HandOrigin);
+	}
+
+	const FString Config = FString::Printf(TEXT("Interactibles=%d Poses=%s"), VRBenchmarkCvars::Interactibles, *GetPoseConfig(PoseStream));
+	FVRBenchmarkRecorder Recorder(TEXT("Interactibles"), Config);
+
+	BenchWorld.Run(Recorder, [&](int32 Frame)
+	{
+		for (int32 i = 0; i < Controllers.Num(); ++i)
+			Controllers[i]->SetRelativeTransform(PoseStream.GetPose(Frame, i) * ControllerOrigins[i]);
+	});
+
+	Recorder.Report(*this);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkCharacterMovementTest, "VRExpansionPlugin.Benchmark.CharacterMovement", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkCharacterMovementTest::RunTest(const FString & Parameters)
+{
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	BenchWorld.SpawnFloor();
+
+	// Room scale wandering for the HMD, hands use the default arm sized loops
+	FVRBenchmarkPoseStream HMDStream(FVector(0.f, 0.f, 170.f), 30.f);
+	FVRBenchmarkPoseStream HandStream;
+
+	TArray<AVRCharacter*> Characters;
+	TArray<FVector> StartLocations;
+	for (int32 i = 0; i < VRBenchmarkCvars::Characters; ++i)
+	{
+		const FVector Location((i % 8) * 300.f, (i / 8) * 300.f, 100.f);
+		AVRCharacter * Character = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FTransform(Location));
+		if (!Character)
+		{
+			AddError(TEXT("Failed to spawn a benchmark character"));
+			return false;
+		}
+
+		// An AI controller makes it locally controlled, so the root and movement run the same paths as a player
+		Character->SpawnDefaultController();
+		if (!Character->Controller)
+		{
+			AddError(TEXT("Benchmark character has no AI controller class to possess it with"));
+			return false;
+		}
+
+		Character->LeftMotionController->bUseWithoutTracking = true;
+		Character->RightMotionController->bUseWithoutTracking = true;
+
+		Characters.Add(Character);
+		StartLocations.Add(Character->GetActorLocation());
+	}
+
+	const FString Config = FString::Printf(TEXT("Characters=%d Poses=%s"), VRBenchmarkCvars::Characters, *VRBenchmarkStatics::GetPoseConfig(HMDStream));
+	FVRBenchmarkRecorder Recorder(TEXT("CharacterMovement"), Config);
+
+	BenchWorld.Run(Recorder, [&](int32 Frame)
+	{
+		for (int32 i = 0; i < Characters.Num(); ++i)
+		{
+			AVRCharacter * Character = Characters[i];
+			Character->VRReplicatedCamera->SetRelativeTransform(HMDStream.GetPose(Frame, i));
+			Character->LeftMotionController->SetRelativeTransform(HandStream.GetPose(Frame, i * 2));
+			Character->RightMotionController->SetRelativeTransform(HandStream.GetPose(Frame, i * 2 + 1));
+
+			// Thumbstick locomotion in a slowly turning direction
+			const float Heading = (float)Frame * 0.01f + (float)i;
+			Character->AddMovementInput(FVector(FMath::Cos(Heading), FMath::Sin(Heading), 0.f), 1.f);
+		}
+	});
+
+	// Make sure the frames were actually spent moving
+	int32 NumMoved = 0;
+	for (int32 i = 0; i < Characters.Num(); ++i)
+	{
+		if (FVector::DistSquared2D(Characters[i]->GetActorLocation(), StartLocations[i]) > FMath::Square(10.f))
+			++NumMoved;
+	}
+	TestEqual(TEXT("Benchmark characters moved"), NumMoved, Characters.Num());
+
+	Recorder.Report(*this);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkStationaryFloorTest, "VRExpansionPlugin.Benchmark.StationaryFloor", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkStationaryFloorTest::RunTest(const FString & Parameters)
+{
+	const float DeltaTime = 1.f / 90.f;
+	int32 NumTraces[2] = { 0, 0 };
+
+	// Same players standing still with the floor cache off and on
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bFloorCache = Pass == 1;
+
+		FVRBenchmarkWorld BenchWorld;
+		UWorld * World = BenchWorld.GetWorld();
+		BenchWorld.SpawnFloor();
+
+		TArray<AVRCharacter*> Characters;
+		TArray<UVRCharacterMovementComponent*> Movements;
+		for (int32 i = 0; i < VRBenchmarkCvars::Characters; ++i)
+		{
+			const FVector Location((i % 8) * 300.f, (i / 8) * 300.f, 100.f);
+			AVRCharacter * Character = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FTransform(Location));
+			UVRCharacterMovementComponent * Movement = Character ? Cast<UVRCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+			if (!Movement)
+			{
+				AddError(TEXT("Failed to spawn a benchmark character"));
+				return false;
+			}
+
+			Character->SpawnDefaultController();
+			if (!Character->Controller)
+			{
+				AddError(TEXT("Benchmark character has no AI controller class to possess it with"));
+				return false;
+			}
+
+			Movement->FloorCacheTolerance = bFloorCache ? 1.0f : 0.0f;
+
+			Characters.Add(Character);
+			Movements.Add(Movement);
+		}
+
+		const FString Config = FString::Printf(TEXT("Characters=%d FloorCacheTolerance=%.1f"), Characters.Num(), bFloorCache ? 1.0f : 0.0f);
+		FVRBenchmarkRecorder Recorder(bFloorCache ? TEXT("StationaryFloorCached") : TEXT("StationaryFloor"), Config);
+
+		// Standing still with the headset on, the tracking noise moves the capsule a fraction of a cm each frame
+		FRandomStream Stream(33);
+		BenchWorld.Run(Recorder, [&](int32 Frame)
+		{
+			for (AVRCharacter * Character : Characters)
+			{
+				const FVector Jitter(Stream.FRandRange(-0.2f, 0.2f), Stream.FRandRange(-0.2f, 0.2f), 0.f);
+				const FRotator RotJitter(Stream.FRandRange(-0.1f, 0.1f), Stream.FRandRange(-0.1f, 0.1f), 0.f);
+				Character->VRReplicatedCamera->SetRelativeTransform(FTransform(RotJitter, FVector(0.f, 0.f, 170.f) + Jitter));
+			}
+		}, DeltaTime);
+
+		int32 NumCacheHits = 0;
+		for (UVRCharacterMovementComponent * Movement : Movements)
+		{
+			NumTraces[Pass] += Movement->NumFloorTraces;
+			NumCacheHits += Movement->NumFloorCacheHits;
+		}
+
+		const float SimulatedSeconds = (FMath::Max(VRBenchmarkCvars::WarmupFrames, 0) + FMath::Max(VRBenchmarkCvars::Frames, 1)) * DeltaTime;
+		AddInfo(FString::Printf(TEXT("%s: %.1f floor traces per second per player, %d cache hits"),
+			bFloorCache ? TEXT("Floor cache") : TEXT("No floor cache"), Characters.Num() > 0 ? NumTraces[Pass] / (SimulatedSeconds * Characters.Num()) : 0.f, NumCacheHits));
+
+		Recorder.Report(*this);
+	}
+
+	TestTrue(TEXT("Floor cache doesn't add traces"), NumTraces[1] <= NumTraces[0]);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkServerMovesTest, "VRExpansionPlugin.Benchmark.ServerMoves", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkServerMovesTest::RunTest(const FString & Parameters)
+{
+	IConsoleVariable * BudgetCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("vre.ServerMoveBudgetMS"));
+	if (!BudgetCVar)
+	{
+		AddError(TEXT("vre.ServerMoveBudgetMS is missing"));
+		return false;
+	}
+
+	const float OriginalBudget = BudgetCVar->GetFloat();
+	const float DeltaTime = 1.f / 90.f;
+	const int32 NumWarmup = FMath::Max(VRBenchmarkCvars::WarmupFrames, 0);
+	const int32 NumFrames = NumWarmup + FMath::Max(VRBenchmarkCvars::Frames, 1);
+
+	// Same arrival pattern with the budget off and on
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bBudgeted = Pass == 1;
+		BudgetCVar->Set(bBudgeted ? VRBenchmarkCvars::ServerMoveBudgetMS : 0.0f, ECVF_SetByCode);
+
+		FVRBenchmarkWorld BenchWorld;
+		UWorld * World = BenchWorld.GetWorld();
+		BenchWorld.SpawnFloor();
+
+		// Server side copies of remote players, nothing possesses them so all of their movement comes from the moves sent in
+		TArray<UVRCharacterMovementComponent*> Movements;
+		for (int32 i = 0; i < VRBenchmarkCvars::ServerMoveClients; ++i)
+		{
+			const FVector Location((i % 8) * 300.f, (i / 8) * 300.f, 100.f);
+			AVRCharacter * Character = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FTransform(Location));
+			UVRCharacterMovementComponent * Movement = Character ? Cast<UVRCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+			if (!Movement)
+			{
+				AddError(TEXT("Failed to spawn a benchmark character"));
+				BudgetCVar->Set(OriginalBudget, ECVF_SetByCode);
+				return false;
+			}
+
+			Movements.Add(Movement);
+		}
+
+		// Moves a client has sent that the network is still holding back
+		struct FClientStream
+		{
+			float TimeStamp = 0.f;
+			int32 DelayFramesLeft = 0;
+			TArray<float> HeldTimeStamps;
+		};
+		TArray<FClientStream> Clients;
+		Clients.SetNum(Movements.Num());
+
+		FRandomStream Stream(38);
+		int32 MaxQueuedMoves = 0;
+		int64 NumMovesSent = 0;
+
+		const FString Config = FString::Printf(TEXT("Clients=%d BudgetMs=%.2f"), Movements.Num(), bBudgeted ? VRBenchmarkCvars::ServerMoveBudgetMS : 0.0f);
+		FVRBenchmarkRecorder Recorder(bBudgeted ? TEXT("ServerMovesBudgeted") : TEXT("ServerMoves"), Config);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const bool bRecord = Frame >= NumWarmup;
+			if (bRecord)
+				Recorder.BeginFrame();
+
+			// Moves arrive before the world ticks like they would from the net drivers dispatch
+			for (int32 i = 0; i < Movements.Num(); ++i)
+			{
+				FClientStream & Client = Clients[i];
+				UVRCharacterMovementComponent * Movement = Movements[i];
+
+				Client.TimeStamp += DeltaTime;
+				Client.HeldTimeStamps.Add(Client.TimeStamp);
+
+				// Now and then a client lags and a few frames worth of moves show up at once
+				if (Client.DelayFramesLeft == 0 && Stream.FRand() < 0.03f)
+					Client.DelayFramesLeft = Stream.RandRange(2, 8);
+
+				if (Client.DelayFramesLeft > 0)
+				{
+					--Client.DelayFramesLeft;
+					continue;
+				}
+
+				// Thumbstick locomotion in a slowly turning direction
+				const float Heading = (float)Frame * 0.01f + (float)i;
+				const FVector Accel = FVector(FMath::Cos(Heading), FMath::Sin(Heading), 0.f) * Movement->GetMaxAcceleration();
+				const FVector ClientLoc = Movement->GetActorLocation();
+
+				FVRConditionalMoveRep2 MoveReps;
+				MoveReps.ClientYaw = FRotator::CompressAxisToShort(FMath::RadiansToDegrees(Heading));
+
+				for (float TimeStamp : Client.HeldTimeStamps)
+				{
+					Movement->ServerMoveVR_Implementation(TimeStamp, Accel, ClientLoc, FVector::ZeroVector, FVRConditionalMoveRep(), FVector_NetQuantize100(FVector::ZeroVector), MoveReps.ClientYaw, 0, MoveReps, Movement->PackNetworkMovementMode());
+					++NumMovesSent;
+				}
+
+				Client.HeldTimeStamps.Reset();
+				MaxQueuedMoves = FMath::Max(MaxQueuedMoves, Movement->QueuedServerMoves.Num());
+			}
+
+			World->Tick(LEVELTICK_All, DeltaTime);
+
+			if (bRecord)
+				Recorder.EndFrame();
+
+			++GFrameCounter;
+		}
+
+		TestTrue(TEXT("Queued server moves stay under the cap"), MaxQueuedMoves <= VR_MAX_QUEUED_SERVER_MOVES);
+		AddInfo(FString::Printf(TEXT("%s: %lld moves from %d clients, most queued on one character %d"), bBudgeted ? TEXT("Budgeted") : TEXT("Unbudgeted"), NumMovesSent, Movements.Num(), MaxQueuedMoves));
+
+		// Reports P50 / P95 / Max of the server frame
+		Recorder.Report(*this);
+	}
+
+	BudgetCVar->Set(OriginalBudget, ECVF_SetByCode);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkSimulatedProxyLODTest, "VRExpansionPlugin.Benchmark.SimulatedProxyLOD", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkSimulatedProxyLODTest::RunTest(const FString & Parameters)
+{
+	// One pass per tier, nothing renders headless so the not rendered time puts every proxy in the low LOD
+	for (int32 Tier = 0; Tier < 2; ++Tier)
+	{
+		const bool bLowLOD = Tier == 1;
+
+		FVRBenchmarkWorld BenchWorld;
+		UWorld * World = BenchWorld.GetWorld();
+		BenchWorld.SpawnFloor();
+
+		TArray<AVRCharacter*> Proxies;
+		TArray<UVRCharacterMovementComponent*> Movements;
+		for (int32 i = 0; i < VRBenchmarkCvars::SimulatedProxies; ++i)
+		{
+			const FVector Location((i % 8) * 300.f, (i / 8) * 300.f, 100.f);
+			AVRCharacter * Character = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FTransform(Location));
+			UVRCharacterMovementComponent * Movement = Character ? Cast<UVRCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+			if (!Movement)
+			{
+				AddError(TEXT("Failed to spawn a benchmark character"));
+				return false;
+			}
+
+			// Stand in for a remote player as a client would see it
+			Character->Role = ROLE_SimulatedProxy;
+			Character->RemoteRole = ROLE_Authority;
+
+			Movement->bUseSimulatedProxyLOD = bLowLOD;
+			Movement->SimulatedProxyLODNotRenderedTime = 0.1f;
+
+			Proxies.Add(Character);
+			Movements.Add(Movement);
+		}
+
+		const FString Config = FString::Printf(TEXT("SimulatedProxies=%d"), Proxies.Num());
+		FVRBenchmarkRecorder Recorder(bLowLOD ? TEXT("SimulatedProxyLowLOD") : TEXT("SimulatedProxyFullLOD"), Config);
+
+		const float DeltaTime = 1.f / 90.f;
+		BenchWorld.Run(Recorder, [&](int32 Frame)
+		{
+			// Replicated movement at 30hz, walking in slow circles
+			if (Frame % 3 != 0)
+				return;
+
+			for (int32 i = 0; i < Proxies.Num(); ++i)
+			{
+				AVRCharacter * Character = Proxies[i];
+				const float Heading = (float)Frame * DeltaTime * 0.5f + (float)i;
+				const FVector Center((i % 8) * 300.f, (i / 8) * 300.f, Character->GetActorLocation().Z);
+				const FVector Direction(FMath::Cos(Heading), FMath::Sin(Heading), 0.f);
+
+				Character->ReplicatedMovement.Location = Center + FVector(Direction.Y, -Direction.X, 0.f) * 100.f;
+				Character->ReplicatedMovement.Rotation = Direction.Rotation();
+				Character->ReplicatedMovement.LinearVelocity = Direction * 50.f;
+				Character->OnRep_ReplicatedMovement();
+			}
+		}, DeltaTime);
+
+		int32 NumInTier = 0;
+		for (UVRCharacterMovementComponent * Movement : Movements)
+			NumInTier += Movement->bIsSimulatedProxyLowLOD == bLowLOD ? 1 : 0;
+
+		TestEqual(bLowLOD ? TEXT("Every proxy ran the low LOD") : TEXT("Every proxy ran the full simulation"), NumInTier, Movements.Num());
+
+		// Game thread cost of every proxy in the tier
+		Recorder.Report(*this);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkGesturesTest, "VRExpansionPlugin.Benchmark.Gestures", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkGesturesTest::RunTest(const FString & Parameters)
+{
+	using namespace VRBenchmarkStatics;
+
+	UGesturesDatabase * GesturesDB = NewObject<UGesturesDatabase>();
+	for (int32 i = 0; i < VRBenchmarkCvars::GestureTemplates; ++i)
+	{
+		GesturesDB->Gestures.Add(MakeBenchmarkGesture(i, 20 + (i % 3) * 10));
+	}
+	GesturesDB->RecalculateGestures(true);
+
+	// Each pass garbage collects its world when it finishes
+	GesturesDB->AddToRoot();
+
+	// Both detection paths against the same database and hand motion
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bStreaming = Pass == 1;
+
+		FVRBenchmarkWorld BenchWorld;
+		UWorld * World = BenchWorld.GetWorld();
+		FVRBenchmarkPoseStream PoseStream;
+
+		TArray<UVRGestureComponent*> GestureComponents;
+		for (int32 i = 0; i < VRBenchmarkCvars::GestureComponents; ++i)
+		{
+			USceneComponent * Origin = SpawnRootActor(World, FVector((i % 8) * 200.f, (i / 8) * 200.f, 0.f));
+
+			UVRGestureComponent * GestureComponent = AddBenchmarkComponent<UVRGestureComponent>(Origin, PoseStream.GetPose(0, i));
+			GestureComponent->GesturesDB = GesturesDB;
+			GestureComponent->bUseStreamingDetection = bStreaming;
+			GestureComponent->BeginRecording(true, true, false, false, 30, 60, 0.01f);
+			GestureComponents.Add(GestureComponent);
+		}
+
+		const FString Config = FString::Printf(TEXT("GestureComponents=%d GestureTemplates=%d Poses=%s"), VRBenchmarkCvars::GestureComponents, VRBenchmarkCvars::GestureTemplates, *GetPoseConfig(PoseStream));
+		FVRBenchmarkRecorder Recorder(bStreaming ? TEXT("GesturesStreaming") : TEXT("Gestures"), Config);
+
+		BenchWorld.Run(Recorder, [&](int32 Frame)
+		{
+			for (int32 i = 0; i < GestureComponents.Num(); ++i)
+				GestureComponents[i]->SetRelativeTransform(PoseStream.GetPose(Frame, i));
+		});
+
+		for (UVRGestureComponent * GestureComponent : GestureComponents)
+			GestureComponent->EndRecording();
+
+		Recorder.Report(*this);
+	}
+
+	GesturesDB->RemoveFromRoot();
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkIdleGrippablesTest, "VRExpansionPlugin.Benchmark.IdleGrippables", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkIdleGrippablesTest::RunTest(const FString & Parameters)
+{
+	using namespace VRBenchmarkStatics;
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+
+	const FString Config = FString::Printf(TEXT("IdleGrippables=%d"), VRBenchmarkCvars::IdleGrippables);
+	FVRBenchmarkRecorder Recorder(TEXT("IdleGrippables"), Config);
+
+	// The recorder has the allocation counter installed from here on
+	FMallocCounter & Counter = GetMallocCounter();
+	const int64 BytesBeforeSpawn = Counter.AllocatedBytes.GetValue();
+
+	// Never gripped or thrown, what a level full of props looks like to the server
+	TArray<AGrippableStaticMeshActor*> Grippables;
+	for (int32 i = 0; i < VRBenchmarkCvars::IdleGrippables; ++i)
+	{
+		const FVector Location((i % 100) * 50.f, (i / 100) * 50.f, 0.f);
+		AGrippableStaticMeshActor * Grippable = World->SpawnActor<AGrippableStaticMeshActor>(AGrippableStaticMeshActor::StaticClass(), FTransform(Location));
+		if (!Grippable)
+		{
+			AddError(TEXT("Failed to spawn a benchmark grippable"));
+			return false;
+		}
+
+		Grippables.Add(Grippable);
+	}
+
+	const int64 SpawnBytes = Counter.AllocatedBytes.GetValue() - BytesBeforeSpawn;
+
+	// ReplicateSubobjects runs for every relevant actor each net update, the engine part needs a channel so only the grippable part is run here
+	double ReplicateSeconds = 0.0;
+	int32 NumWroteSomething = 0;
+	BenchWorld.Run(Recorder, [&](int32 Frame)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (AGrippableStaticMeshActor * Grippable : Grippables)
+			NumWroteSomething += FVRGrippableCore::ReplicateGripScripts(Grippable->GripLogicScripts, nullptr, nullptr, nullptr) ? 1 : 0;
+		ReplicateSeconds += FPlatformTime::Seconds() - StartTime;
+	});
+
+	int32 NumWithThrowingState = 0;
+	for (AGrippableStaticMeshActor * Grippable : Grippables)
+		NumWithThrowingState += Grippable->ClientAuthReplicationData.ThrowingState.IsValid() ? 1 : 0;
+
+	TestEqual(TEXT("Idle grippables don't allocate throwing state"), NumWithThrowingState, 0);
+	TestEqual(TEXT("Idle grippables have no scripts to replicate"), NumWroteSomething, 0);
+
+	const int32 NumCalls = (FMath::Max(VRBenchmarkCvars::WarmupFrames, 0) + FMath::Max(VRBenchmarkCvars::Frames, 1)) * Grippables.Num();
+	AddInfo(FString::Printf(TEXT("%d idle grippables: actor %d bytes, client auth data %d bytes (+%d bytes only while thrown), %lld bytes allocated per spawn | grip script replication %.1fns per actor"),
+		Grippables.Num(), AGrippableStaticMeshActor::StaticClass()->GetStructureSize(), (int32)sizeof(FVRClientAuthReplicationData), (int32)sizeof(FVRClientAuthThrowingState),
+		Grippables.Num() > 0 ? SpawnBytes / Grippables.Num() : 0, NumCalls > 0 ? ReplicateSeconds * 1000000000.0 / NumCalls : 0.0));
+
+	// Frame time with the grippables sitting in the world
+	Recorder.Report(*this);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkRepulsionPropsTest, "VRExpansionPlugin.Benchmark.RepulsionProps", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkRepulsionPropsTest::RunTest(const FString & Parameters)
+{
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	if (!BenchWorld.GetCubeMesh())
+	{
+		AddWarning(TEXT("Engine cube mesh not found, no props to repulse"));
+		return true;
+	}
+
+	BenchWorld.SpawnFloor();
+
+	AVRCharacter * Character = World->SpawnActor<AVRCharacter>(AVRCharacter::StaticClass(), FTransform(FVector(0.f, 0.f, 100.f)));
+	UVRCharacterMovementComponent * Movement = Character ? Cast<UVRCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+	if (!Movement)
+	{
+		AddError(TEXT("Failed to spawn a benchmark character"));
+		return false;
+	}
+
+	Character->SpawnDefaultController();
+	if (!Character->Controller)
+	{
+		AddError(TEXT("Benchmark character has no AI controller class to possess it with"));
+		return false;
+	}
+
+	Character->VRReplicatedCamera->SetRelativeTransform(FTransform(FVector(0.f, 0.f, 170.f)));
+	World->Tick(LEVELTICK_All, 1.f / 90.f);
+
+	float CapsuleRadius = 0.f;
+	float CapsuleHalfHeight = 0.f;
+	Character->GetCapsuleComponent()->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
+	const FVector CapsuleCenter = Character->VRRootReference->OffsetComponentToWorld.GetLocation();
+
+	// A pile of small props around and inside of the capsule, they overlap the player but not each other
+	TArray<UStaticMeshComponent*> Props;
+	TArray<FVector> PropLocations;
+	FRandomStream Stream(34);
+	for (int32 i = 0; i < VRBenchmarkCvars::RepulsionProps; ++i)
+	{
+		const float Angle = Stream.FRandRange(0.f, 2.f * PI);
+		const float Dist = Stream.FRandRange(0.f, CapsuleRadius * 1.1f);
+		const FVector Location = CapsuleCenter + FVector(FMath::Cos(Angle) * Dist, FMath::Sin(Angle) * Dist, Stream.FRandRange(-CapsuleHalfHeight, CapsuleHalfHeight) * 0.9f);
+
+		AActor * PropActor = World->SpawnActor<AActor>();
+		UStaticMeshComponent * Prop = NewObject<UStaticMeshComponent>(PropActor);
+		Prop->SetMobility(EComponentMobility::Movable);
+		Prop->SetStaticMesh(BenchWorld.GetCubeMesh());
+		Prop->SetCollisionProfileName(UCollisionProfile::PhysicsActor_ProfileName);
+		Prop->SetCollisionResponseToChannel(ECC_PhysicsBody, ECR_Ignore);
+		Prop->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+		Prop->SetGenerateOverlapEvents(true);
+		Prop->SetEnableGravity(false);
+		Prop->SetWorldTransform(FTransform(FQuat::Identity, Location, FVector(0.1f)));
+		PropActor->SetRootComponent(Prop);
+		Prop->RegisterComponent();
+		Prop->SetSimulatePhysics(true);
+
+		Props.Add(Prop);
+		PropLocations.Add(Location);
+	}
+
+	const FString Config = FString::Printf(TEXT("RepulsionProps=%d RepulsionForce=%.1f"), Props.Num(), Movement->RepulsionForce);
+	FVRBenchmarkRecorder Recorder(TEXT("RepulsionProps"), Config);
+
+	// Props are put back every frame so the pile doesn't get pushed away during the run
+	BenchWorld.Run(Recorder, [&](int32 Frame)
+	{
+		for (int32 i = 0; i < Props.Num(); ++i)
+		{
+			Props[i]->SetWorldLocation(PropLocations[i], false, nullptr, ETeleportType::TeleportPhysics);
+			Props[i]->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		}
+	});
+
+	const int32 NumOverlaps = Character->VRRootReference->GetOverlapInfos().Num();
+	AddInfo(FString::Printf(TEXT("%d props, %d overlapping the capsule at the end of the run"), Props.Num(), NumOverlaps));
+	TestTrue(TEXT("Props overlap the character"), NumOverlaps > 0);
+
+	Recorder.Report(*this);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRBenchmarkButtonPanelTest, "VRExpansionPlugin.Benchmark.ButtonPanel", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVRBenchmarkButtonPanelTest::RunTest(const FString & Parameters)
+{
+	using namespace VRBenchmarkStatics;
+
+	const int32 NumButtons = FMath::Max(VRBenchmarkCvars::PanelButtons, 4);
+	const int32 NumFingertips = 4;
+	const int32 NumColumns = 16;
+	const float ButtonSpacing = 8.f;
+	const int32 PressFrames = 50;
+	const int32 NumWarmup = FMath::Max(VRBenchmarkCvars::WarmupFrames, 0);
+	const int32 NumFrames = NumWarmup + FMath::Max(VRBenchmarkCvars::Frames, 1);
+	const float DeltaTime = 1.f / 90.f;
+
+	struct FPassResult
+	{
+		int32 NumTouches = 0;
+		int32 NumStateChanges = 0;
+		TArray<bool> FinalStates;
+	};
+	FPassResult Results[2];
+	int32 NumRenderStateUpdates = 0;
+
+	// Same keypad and fingertip paths as one panel and as individual button components
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bPanel = Pass == 0;
+
+		FVRBenchmarkWorld BenchWorld;
+		UWorld * World = BenchWorld.GetWorld();
+		if (!TestNotNull(TEXT("Benchmark world"), World))
+			return false;
+
+		// The individual buttons find the fingertips through their collision
+		if (!bPanel && !BenchWorld.GetCubeMesh())
+		{
+			AddWarning(TEXT("Engine cube mesh not found, skipping the individual button components"));
+			break;
+		}
+
+		USceneComponent * Origin = SpawnRootActor(World, FVector(0.f, 0.f, 100.f));
+
+		UVRButtonPanelComponent * Panel = nullptr;
+		TArray<UVRButtonComponent*> ButtonComps;
+
+		if (bPanel)
+		{
+			Panel = AddBenchmarkComponent<UVRButtonPanelComponent>(Origin);
+			Panel->SetStaticMesh(BenchWorld.GetCubeMesh());
+			for (int32 i = 0; i < NumButtons; ++i)
+			{
+				FVRPanelButton Button;
+				Button.RelativeTransform = FTransform(FVector((i % NumColumns) * ButtonSpacing, (i / NumColumns) * ButtonSpacing, 0.f));
+				Panel->Buttons.Add(Button);
+			}
+			Panel->RebuildButtons();
+		}
+		else
+		{
+			// 5x5x10 like the panels default press box, the depress settings are in the scaled local space so they are scaled up to match
+			for (int32 i = 0; i < NumButtons; ++i)
+			{
+				const FTransform ButtonTransform(FQuat::Identity, FVector((i % NumColumns) * ButtonSpacing, (i / NumColumns) * ButtonSpacing, 0.f), FVector(0.05f, 0.05f, 0.1f));
+				UVRButtonComponent * ButtonComp = AddBenchmarkComponent<UVRButtonComponent>(Origin, ButtonTransform);
+				ButtonComp->SetStaticMesh(BenchWorld.GetCubeMesh());
+				ButtonComp->bSkipOverlapFiltering = true;
+				ButtonComp->DepressDistance = 80.f;
+				ButtonComp->ButtonEngageDepth = 80.f;
+				ButtonComp->DepressSpeed = 500.f;
+				ButtonComps.Add(ButtonComp);
+			}
+		}
+
+		TArray<USphereComponent*> Fingertips;
+		for (int32 i = 0; i < NumFingertips; ++i)
+		{
+			AActor * HandActor = World->SpawnActor<AActor>();
+			USphereComponent * Fingertip = NewObject<USphereComponent>(HandActor);
+			Fingertip->SetMobility(EComponentMobility::Movable);
+			Fingertip->InitSphereRadius(0.5f);
+			Fingertip->SetWorldLocation(FVector(0.f, 0.f, -1000.f));
+
+			if (bPanel)
+			{
+				// Only probed, no overlaps needed
+				Fingertip->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+				Fingertip->SetGenerateOverlapEvents(false);
+			}
+			else
+			{
+				Fingertip->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+				Fingertip->SetCollisionResponseToAllChannels(ECR_Overlap);
+				Fingertip->SetGenerateOverlapEvents(true);
+			}
+
+			HandActor->SetRootComponent(Fingertip);
+			Fingertip->RegisterComponent();
+			Fingertips.Add(Fingertip);
+
+			if (Panel)
+				Panel->RegisterFingertip(Fingertip);
+		}
+
+		FPassResult & Result = Results[Pass];
+		TArray<bool> WasInUse;
+		TArray<bool> LastStates;
+		WasInUse.Init(false, NumButtons);
+		LastStates.Init(false, NumButtons);
+
+		const FString Config = FString::Printf(TEXT("Buttons=%d Fingertips=%d"), NumButtons, NumFingertips);
+		FVRBenchmarkRecorder Recorder(bPanel ? TEXT("ButtonPanel") : TEXT("ButtonPanelComponents"), Config);
+
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			const bool bRecord = Frame >= NumWarmup;
+			if (bRecord)
+				Recorder.BeginFrame();
+
+			// Each fingertip goes down onto a button, holds it and comes back up, then moves over to its next one
+			// The overlap updates from moving them are part of what the individual components cost so this is recorded
+			const int32 PressIndex = Frame / PressFrames;
+			const int32 PressFrame = Frame % PressFrames;
+			float Height = -4.5f;
+			if (PressFrame < 20)
+				Height = FMath::Lerp(10.f, -4.5f, PressFrame / 19.f);
+			else if (PressFrame >= 30)
+				Height = FMath::Lerp(-4.5f, 10.f, (PressFrame - 30) / 19.f);
+
+			for (int32 i = 0; i < Fingertips.Num(); ++i)
+			{
+				// Stepping by a number coprime to the button count keeps the fingertips on different buttons
+				const int32 ButtonIndex = ((PressIndex * NumFingertips + i) * 7) % NumButtons;
+				const FVector ButtonLoc((ButtonIndex % NumColumns) * ButtonSpacing, (ButtonIndex / NumColumns) * ButtonSpacing, Height);
+				Fingertips[i]->SetWorldLocation(Origin->GetComponentTransform().TransformPosition(ButtonLoc));
+			}
+
+			World->Tick(LEVELTICK_All, DeltaTime);
+
+			if (bRecord)
+				Recorder.EndFrame();
+
+			++GFrameCounter;
+
+			for (int32 i = 0; i < NumButtons; ++i)
+			{
+				const bool bInUse = bPanel ? Panel->IsButtonInUse(i) : ButtonComps[i]->IsButtonInUse();
+				const bool bState = bPanel ? Panel->GetButtonState(i) : ButtonComps[i]->bButtonState;
+
+				Result.NumTouches += (bInUse && !WasInUse[i]) ? 1 : 0;
+				Result.NumStateChanges += (bState != LastStates[i]) ? 1 : 0;
+				WasInUse[i] = bInUse;
+				LastStates[i] = bState;
+			}
+		}
+
+		Result.FinalStates = LastStates;
+
+		if (Panel)
+			NumRenderStateUpdates = Panel->NumRenderStateUpdates;
+
+		AddInfo(FString::Printf(TEXT("%s: %d touches, %d state changes"), bPanel ? TEXT("Panel") : TEXT("Individual components"), Result.NumTouches, Result.NumStateChanges));
+		Recorder.Report(*this);
+	}
+
+	TestTrue(TEXT("Fingertips pressed buttons"), Results[0].NumStateChanges > 0);
+	TestTrue(TEXT("Panel marks its render state at most once per frame"), NumRenderStateUpdates <= NumFrames);
+
+	if (Results[1].FinalStates.Num() > 0)
+	{
+		TestEqual(TEXT("Panel sees the same touches as the components"), Results[0].NumTouches, Results[1].NumTouches);
+		TestEqual(TEXT("Panel changes state as often as the components"), Results[0].NumStateChanges, Results[1].NumStateChanges);
+
+		int32 NumMismatchedStates = 0;
+		for (int32 i = 0; i < NumButtons; ++i)
+			NumMismatchedStates += Results[0].FinalStates[i] != Results[1].FinalStates[i] ? 1 : 0;
+
+		TestEqual(TEXT("Panel ends with the same button states"), NumMismatchedStates, 0);
+	}
+
+	AddInfo(FString::Printf(TEXT("Panel render state updates: %d over %d frames"), NumRenderStateUpdates, NumFrames));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
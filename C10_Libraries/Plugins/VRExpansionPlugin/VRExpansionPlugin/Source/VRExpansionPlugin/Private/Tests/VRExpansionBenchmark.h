@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class UWorld;
+class AActor;
+class UStaticMesh;
+
+/*
+* Headless benchmark harness for the VRExpansion automation tests (VRExpansionPlugin.Benchmark.*)
+*
+* Run without an HMD and without rendering, IE:
+* UE4Editor-Cmd.exe Project.uproject -nullrhi -unattended -ExecCmds="vre.Benchmark.Characters 32;Automation RunTests VRExpansionPlugin.Benchmark;Quit"
+*
+* Each scenario writes Saved/VRExpansionBenchmarks/<Scenario>.csv (per frame timings and allocations) and <Scenario>_Summary.csv.
+* Summaries are compared against the one in the baseline directory and a warning is raised when over vre.Benchmark.RegressionPercent.
+* Set vre.Benchmark.WriteBaseline 1 to store the current results as the new baseline.
+*/
+namespace VRBenchmarkCvars
+{
+	extern int32 Frames;
+	extern int32 WarmupFrames;
+	extern int32 Controllers;
+	extern int32 GripsPerController;
+	extern int32 PhysicsGrips;
+	extern int32 Interactibles;
+	extern int32 Characters;
+	extern int32 ServerMoveClients;
+	extern float ServerMoveBudgetMS;
+	extern int32 SimulatedProxies;
+	extern int32 GestureComponents;
+	extern int32 GestureTemplates;
+	extern int32 Avatars;
+	extern int32 IdleGrippables;
+	extern int32 RepulsionProps;
+	extern int32 PanelButtons;
+	extern FString PoseFile;
+	extern FString BaselineDir;
+	extern int32 WriteBaseline;
+	extern float RegressionPercent;
+}
+
+// Scripted or recorded relative poses to drive controllers, cameras and gesture components with
+class FVRBenchmarkPoseStream
+{
+public:
+
+	// Loads the recorded stream from vre.Benchmark.PoseFile if one is set, otherwise poses are scripted
+	// Recorded files are one pose per line: X,Y,Z,Pitch,Yaw,Roll relative to the tracking origin, lines starting with # are skipped
+	FVRBenchmarkPoseStream(const FVector & InScriptedCenter = FVector(30.f, 0.f, 120.f), float InScriptedRadius = 15.f);
+
+	// Pose for the frame, each instance is phase shifted so they don't all move in lockstep
+	FTransform GetPose(int32 Frame, int32 Instance) const;
+
+	bool IsRecorded() const { return RecordedPoses.Num() > 0; }
+
+private:
+
+	FVector ScriptedCenter;
+	float ScriptedRadius;
+	TArray<FTransform> RecordedPoses;
+};
+
+// Records per frame time and allocation counts and writes / compares the CSV reports
+class FVRBenchmarkRecorder
+{
+public:
+
+	// Config is written into the summary so baselines from a different setup aren't compared against
+	FVRBenchmarkRecorder(const FString & InScenario, const FString & InConfig);
+	~FVRBenchmarkRecorder();
+
+	void BeginFrame();
+	void EndFrame();
+
+	// Writes the reports and adds a warning to the test for every stat that regressed past the baseline
+	void Report(FAutomationTestBase & Test) const;
+
+private:
+
+	struct FFrameSample
+	{
+		double Milliseconds;
+		int64 Allocations;
+		int64 AllocatedBytes;
+	};
+
+	FString Scenario;
+	FString Config;
+	TArray<FFrameSample> Samples;
+
+	double FrameStartTime;
+	int64 FrameStartAllocations;
+	int64 FrameStartBytes;
+};
+
+// A standalone game world ticked at a fixed rate with nothing else in it
+class FVRBenchmarkWorld
+{
+public:
+
+	FVRBenchmarkWorld();
+	~FVRBenchmarkWorld();
+
+	UWorld * GetWorld() const { return World; }
+
+	// Engine cube, can be null if engine content isn't available
+	UStaticMesh * GetCubeMesh() const { return CubeMesh; }
+
+	// Large static box for characters to stand on
+	AActor * SpawnFloor();
+
+	// Ticks WarmupFrames unrecorded, then Frames recorded. PreTick is called with the frame index before each tick to push the poses in
+	void Run(FVRBenchmarkRecorder & Recorder, TFunctionRef<void(int32 Frame)> PreTick, float DeltaTime = 1.f / 90.f);
+
+private:
+
+	UWorld * World;
+	UStaticMesh * CubeMesh;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
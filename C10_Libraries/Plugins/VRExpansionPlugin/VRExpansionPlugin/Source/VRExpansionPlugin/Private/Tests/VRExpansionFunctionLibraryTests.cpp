@@ -0,0 +1,128 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRExpansionFunctionLibrary.h"
+#include "Engine/Engine.h"
+#include "XRTrackingSystemBase.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRExpansionFunctionLibraryTestStatics
+{
+	// Tracking system that counts pose queries, every query returns a new pose like a live sensor would
+	class FStubTrackingSystem : public FXRTrackingSystemBase
+	{
+	public:
+
+		TMap<int32, int32> NumPoseQueries;
+		int32 NumTotalQueries;
+
+		FStubTrackingSystem() : FXRTrackingSystemBase(nullptr), NumTotalQueries(0) {}
+
+		virtual FName GetSystemName() const { return FName(TEXT("VRExpansionStubTracking")); }
+		virtual bool DoesSupportPositionalTracking() const { return true; }
+		virtual bool IsHeadTrackingAllowed() const { return true; }
+		virtual float GetWorldToMetersScale() const { return 100.f; }
+		virtual void ResetOrientationAndPosition(float Yaw = 0.f) {}
+
+		virtual bool EnumerateTrackedDevices(TArray<int32>& OutDevices, EXRTrackedDeviceType Type = EXRTrackedDeviceType::Any)
+		{
+			OutDevices.Add(IXRTrackingSystem::HMDDeviceId);
+			return true;
+		}
+
+		virtual bool GetCurrentPose(int32 DeviceId, FQuat& OutOrientation, FVector& OutPosition)
+		{
+			++NumPoseQueries.FindOrAdd(DeviceId);
+			++NumTotalQueries;
+
+			OutOrientation = FRotator(0.f, NumTotalQueries * 0.5f, 0.f).Quaternion();
+			OutPosition = FVector(NumTotalQueries * 0.1f, 0.f, 170.f);
+			return true;
+		}
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRHMDPoseSnapshotTest, "VRExpansionPlugin.Tracking.HMDPoseSnapshot", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRHMDPoseSnapshotTest::RunTest(const FString & Parameters)
+{
+	using namespace VRExpansionFunctionLibraryTestStatics;
+
+	if (!GEngine)
+		return false;
+
+	// Swapped in for the length of the test, a real HMD would be driving the same calls otherwise
+	TSharedPtr<FStubTrackingSystem, ESPMode::ThreadSafe> StubTracking = MakeShareable(new FStubTrackingSystem());
+	TSharedPtr<IXRTrackingSystem, ESPMode::ThreadSafe> OriginalXRSystem = GEngine->XRSystem;
+	GEngine->XRSystem = StubTracking;
+
+	// Root component, camera, parent relative attachment, simple character movement, gun tools and the grip controller
+	const int32 NumConsumers = 6;
+	const int32 NumFrames = 90;
+
+	int32 NumMismatchedPoses = 0;
+	int32 NumMismatchedTimeStamps = 0;
+	int32 NumFramesWithoutNewPose = 0;
+	FVector LastFramePosition = FVector(-1.f);
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		// Normally the engine loop does this
+		++GFrameCounter;
+
+		FQuat FirstOrientation;
+		FVector FirstPosition;
+		double FirstTimeStamp = 0.0;
+
+		for (int32 Consumer = 0; Consumer < NumConsumers; ++Consumer)
+		{
+			FQuat Orientation;
+			FVector Position;
+			if (!UVRExpansionFunctionLibrary::GetHMDPoseForFrame(Orientation, Position))
+			{
+				++NumMismatchedPoses;
+				continue;
+			}
+
+			const double TimeStamp = UVRExpansionFunctionLibrary::GetHMDPoseSnapshot().TimeStamp;
+
+			if (Consumer == 0)
+			{
+				FirstOrientation = Orientation;
+				FirstPosition = Position;
+				FirstTimeStamp = TimeStamp;
+
+				if (Position.Equals(LastFramePosition))
+					++NumFramesWithoutNewPose;
+
+				LastFramePosition = Position;
+				continue;
+			}
+
+			// Bit for bit the same, not just close
+			if (Orientation != FirstOrientation || Position != FirstPosition)
+				++NumMismatchedPoses;
+
+			if (TimeStamp != FirstTimeStamp)
+				++NumMismatchedTimeStamps;
+		}
+	}
+
+	GEngine->XRSystem = OriginalXRSystem;
+
+	// Don't leave the stubs pose in the snapshot for the rest of the frame
+	++GFrameCounter;
+
+	TestEqual(TEXT("HMD is queried once per frame"), StubTracking->NumPoseQueries.FindRef(IXRTrackingSystem::HMDDeviceId), NumFrames);
+	TestEqual(TEXT("Only the HMD is queried"), StubTracking->NumTotalQueries, NumFrames);
+	TestEqual(TEXT("Every consumer sees the same pose within a frame"), NumMismatchedPoses, 0);
+	TestEqual(TEXT("Every consumer sees the same timestamp within a frame"), NumMismatchedTimeStamps, 0);
+	TestEqual(TEXT("Each frame samples a new pose"), NumFramesWithoutNewPose, 0);
+
+	AddInfo(FString::Printf(TEXT("%d frames x %d consumers: %d tracking system queries"), NumFrames, NumConsumers, StubTracking->NumTotalQueries));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,348 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRGestureComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRGestureTestStatics
+{
+	static const int32 TemplateSamples = 30;
+	static const int32 NumShapes = 3;
+
+	// Circle that starts and ends at the origin, a side to side swipe and a V, all in the YZ plane
+	static FVector GetShapePoint(int32 Shape, float U)
+	{
+		switch (Shape)
+		{
+		case 0: return FVector(0.f, 30.f * FMath::Sin(2.f * PI * U), 30.f - 30.f * FMath::Cos(2.f * PI * U));
+		case 1: return FVector(0.f, -40.f + 80.f * U, 0.f);
+		default: return FVector(0.f, -30.f + 60.f * U, -30.f + 60.f * FMath::Abs(2.f * U - 1.f));
+		}
+	}
+
+	// Stub database, with scaling off the stream samples are compared as is
+	static UGesturesDatabase * MakeGestureDB(bool bEnableScaling = false)
+	{
+		UGesturesDatabase * GesturesDB = NewObject<UGesturesDatabase>(GetTransientPackage());
+
+		for (int32 Shape = 0; Shape < NumShapes; ++Shape)
+		{
+			FVRGesture Gesture;
+			Gesture.Name = FString::Printf(TEXT("Shape%d"), Shape);
+			Gesture.GestureType = Shape;
+			Gesture.GestureSettings.firstThreshold = 10.f;
+			Gesture.GestureSettings.FullThreshold = 8.f;
+			Gesture.GestureSettings.bEnableScaling = bEnableScaling;
+
+			// Newest sample first like a recording
+			for (int32 i = TemplateSamples - 1; i >= 0; --i)
+				Gesture.Samples.Add(GetShapePoint(Shape, (float)i / (TemplateSamples - 1)));
+
+			Gesture.CalculateSizeOfGesture();
+			GesturesDB->Gestures.Add(Gesture);
+		}
+
+		return GesturesDB;
+	}
+
+	struct FEmbeddedGesture
+	{
+		int32 Shape;
+		int32 FirstSample;
+		int32 LastSample;
+	};
+
+	// Jitter around the origin with randomly picked gestures performed at different speeds in between
+	static void MakeStream(FRandomStream & Stream, TArray<FVector> & OutSamples, TArray<FEmbeddedGesture> & OutGestures, float Scale = 1.f)
+	{
+		const int32 IdleSamples = 15;
+		const int32 TransitionSamples = 6;
+
+		auto AddIdle = [&]()
+		{
+			for (int32 i = 0; i < IdleSamples; ++i)
+				OutSamples.Add(Stream.VRand() * Stream.FRandRange(0.f, 1.f));
+		};
+
+		auto AddTransition = [&](const FVector & From, const FVector & To)
+		{
+			for (int32 i = 1; i <= TransitionSamples; ++i)
+				OutSamples.Add(FMath::Lerp(From, To, (float)i / TransitionSamples) + Stream.VRand() * Stream.FRandRange(0.f, 1.f));
+		};
+
+		AddIdle();
+
+		for (int32 g = 0; g < 5; ++g)
+		{
+			FEmbeddedGesture Embedded;
+			Embedded.Shape = Stream.RandRange(0, NumShapes - 1);
+
+			AddTransition(FVector::ZeroVector, GetShapePoint(Embedded.Shape, 0.f));
+
+			// Stretched or squashed in time and sped up or slowed down through the middle
+			const int32 NumSamples = FMath::TruncToInt(TemplateSamples * Stream.FRandRange(0.8f, 1.3f));
+			const float Warp = Stream.FRandRange(-0.1f, 0.1f);
+
+			Embedded.FirstSample = OutSamples.Num();
+			for (int32 i = 0; i < NumSamples; ++i)
+			{
+				const float S = (float)i / (NumSamples - 1);
+				OutSamples.Add(GetShapePoint(Embedded.Shape, S + Warp * FMath::Sin(PI * S)) + Stream.VRand() * Stream.FRandRange(0.f, 2.f));
+			}
+			Embedded.LastSample = OutSamples.Num() - 1;
+			OutGestures.Add(Embedded);
+
+			AddTransition(GetShapePoint(Embedded.Shape, 1.f), FVector::ZeroVector);
+			AddIdle();
+		}
+
+		// Same motion performed smaller or larger
+		for (FVector & Sample : OutSamples)
+			Sample *= Scale;
+	}
+
+	static UVRGestureComponent * MakeGestureComponent(UGesturesDatabase * GesturesDB, bool bStreaming, int32 BufferSize = 60, float StreamingGestureSize = 0.f)
+	{
+		UVRGestureComponent * GestureComp = NewObject<UVRGestureComponent>(GetTransientPackage());
+		GestureComp->GesturesDB = GesturesDB;
+		GestureComp->RecordingBufferSize = BufferSize;
+		GestureComp->StreamingGestureSize = StreamingGestureSize;
+		GestureComp->bUseStreamingDetection = bStreaming;
+		GestureComp->CurrentState = EVRGestureState::GES_Detecting;
+		GestureComp->GestureLog.Samples.Reset(GestureComp->RecordingBufferSize);
+
+		if (bStreaming)
+			GestureComp->ResetStreamingDetection();
+
+		return GestureComp;
+	}
+
+	// Same buffer handling as CaptureGestureFrame
+	static void PushSample(UVRGestureComponent * GestureComp, const FVector & NewSample)
+	{
+		if (GestureComp->GestureLog.Samples.Num() >= GestureComp->RecordingBufferSize)
+			GestureComp->GestureLog.Samples.Pop(false);
+
+		GestureComp->GestureLog.Samples.Insert(NewSample, 0);
+		GestureComp->bGestureChanged = true;
+	}
+
+	// Streams the samples and returns the shape and sample index of each detection
+	static TArray<FIntPoint> RunStreaming(UVRGestureComponent * GestureComp, const TArray<FVector> & Samples)
+	{
+		TArray<FIntPoint> Detections;
+		for (int32 i = 0; i < Samples.Num(); ++i)
+		{
+			PushSample(GestureComp, Samples[i]);
+			const int32 Detected = GestureComp->StreamGestureSample(Samples[i]);
+			if (Detected != -1)
+				Detections.Add(FIntPoint(Detected, i));
+		}
+
+		return Detections;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRGestureStreamingMatchesDTWTest, "VRExpansionPlugin.Gestures.StreamingMatchesDTW", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRGestureStreamingMatchesDTWTest::RunTest(const FString & Parameters)
+{
+	using namespace VRGestureTestStatics;
+
+	// Detections can land a little after the gesture ends while streaming waits to see if the match improves
+	const int32 DetectionSlack = 6;
+
+	UGesturesDatabase * GesturesDB = MakeGestureDB();
+
+	for (int32 Seed = 0; Seed < 8; ++Seed)
+	{
+		FRandomStream Stream(Seed);
+		TArray<FVector> Samples;
+		TArray<FEmbeddedGesture> Embedded;
+		MakeStream(Stream, Samples, Embedded);
+
+		UVRGestureComponent * StreamingComp = MakeGestureComponent(GesturesDB, true);
+		UVRGestureComponent * BufferedComp = MakeGestureComponent(GesturesDB, false);
+
+		TArray<FIntPoint> StreamingDetections;
+		TArray<FIntPoint> BufferedDetections;
+
+		for (int32 i = 0; i < Samples.Num(); ++i)
+		{
+			PushSample(StreamingComp, Samples[i]);
+			int32 Detected = StreamingComp->StreamGestureSample(Samples[i]);
+			if (Detected != -1)
+				StreamingDetections.Add(FIntPoint(Detected, i));
+
+			PushSample(BufferedComp, Samples[i]);
+			Detected = BufferedComp->RecognizeGesture(BufferedComp->GestureLog);
+			if (Detected != -1)
+				BufferedDetections.Add(FIntPoint(Detected, i));
+		}
+
+		const FString Context = FString::Printf(TEXT("Seed %d"), Seed);
+
+		TestEqual(*(Context + TEXT(": streaming detects every embedded gesture once")), StreamingDetections.Num(), Embedded.Num());
+		TestEqual(*(Context + TEXT(": RecognizeGesture detects every embedded gesture once")), BufferedDetections.Num(), Embedded.Num());
+
+		if (StreamingDetections.Num() != Embedded.Num() || BufferedDetections.Num() != Embedded.Num())
+			continue;
+
+		for (int32 g = 0; g < Embedded.Num(); ++g)
+		{
+			const FEmbeddedGesture & Expected = Embedded[g];
+			const FString GestureContext = FString::Printf(TEXT("%s gesture %d"), *Context, g);
+
+			TestEqual(*(GestureContext + TEXT(": streaming detects the embedded shape")), StreamingDetections[g].X, Expected.Shape);
+			TestEqual(*(GestureContext + TEXT(": RecognizeGesture detects the embedded shape")), BufferedDetections[g].X, Expected.Shape);
+			TestTrue(*(GestureContext + TEXT(": streaming detects it while it is performed")), StreamingDetections[g].Y >= Expected.FirstSample && StreamingDetections[g].Y <= Expected.LastSample + DetectionSlack);
+			TestTrue(*(GestureContext + TEXT(": RecognizeGesture detects it while it is performed")), BufferedDetections[g].Y >= Expected.FirstSample && BufferedDetections[g].Y <= Expected.LastSample + DetectionSlack);
+		}
+	}
+
+	// Nothing to find in a stream that never leaves the origin
+	{
+		FRandomStream Stream(100);
+		UVRGestureComponent * StreamingComp = MakeGestureComponent(GesturesDB, true);
+		UVRGestureComponent * BufferedComp = MakeGestureComponent(GesturesDB, false);
+
+		int32 NumFalseDetections = 0;
+		for (int32 i = 0; i < 200; ++i)
+		{
+			const FVector Sample = Stream.VRand() * Stream.FRandRange(0.f, 1.f);
+
+			PushSample(StreamingComp, Sample);
+			NumFalseDetections += StreamingComp->StreamGestureSample(Sample) != -1 ? 1 : 0;
+
+			PushSample(BufferedComp, Sample);
+			NumFalseDetections += BufferedComp->RecognizeGesture(BufferedComp->GestureLog) != -1 ? 1 : 0;
+		}
+
+		TestEqual(TEXT("Idle stream detects nothing"), NumFalseDetections, 0);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRGestureStreamingScalingTest, "VRExpansionPlugin.Gestures.StreamingScaling", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRGestureStreamingScalingTest::RunTest(const FString & Parameters)
+{
+	using namespace VRGestureTestStatics;
+
+	// Database scaled gestures, performed at half the size they were recorded at
+	UGesturesDatabase * GesturesDB = MakeGestureDB(true);
+	GesturesDB->TargetGestureScale = 60.f;
+	const float PerformedScale = 0.5f;
+
+	for (int32 Seed = 0; Seed < 4; ++Seed)
+	{
+		FRandomStream Stream(Seed);
+		TArray<FVector> Samples;
+		TArray<FEmbeddedGesture> Embedded;
+		MakeStream(Stream, Samples, Embedded, PerformedScale);
+
+		// Scaler is TargetGestureScale / StreamingGestureSize, brings the samples back up to the template size
+		UVRGestureComponent * StreamingComp = MakeGestureComponent(GesturesDB, true, 60, GesturesDB->TargetGestureScale * PerformedScale);
+		TestEqual(TEXT("Scale is fixed when detection starts"), StreamingComp->StreamingScaler, 1.f / PerformedScale);
+
+		const TArray<FIntPoint> Detections = RunStreaming(StreamingComp, Samples);
+
+		const FString Context = FString::Printf(TEXT("Seed %d"), Seed);
+		TestEqual(*(Context + TEXT(": scaled streaming detects every embedded gesture once")), Detections.Num(), Embedded.Num());
+
+		for (int32 g = 0; g < Detections.Num() && g < Embedded.Num(); ++g)
+			TestEqual(*FString::Printf(TEXT("%s gesture %d: scaled streaming detects the embedded shape"), *Context, g), Detections[g].X, Embedded[g].Shape);
+	}
+
+	// Without a StreamingGestureSize the samples are left alone instead of being scaled by whatever the buffer holds so far
+	{
+		AddExpectedError(TEXT("needs a StreamingGestureSize"), EAutomationExpectedErrorFlags::Contains, 0);
+
+		FRandomStream Stream(0);
+		TArray<FVector> Samples;
+		TArray<FEmbeddedGesture> Embedded;
+		MakeStream(Stream, Samples, Embedded);
+
+		UVRGestureComponent * StreamingComp = MakeGestureComponent(GesturesDB, true);
+		TestEqual(TEXT("No StreamingGestureSize means no scaling"), StreamingComp->StreamingScaler, 1.f);
+		TestEqual(TEXT("Unscaled stream still detects every embedded gesture"), RunStreaming(StreamingComp, Samples).Num(), Embedded.Num());
+	}
+
+	// A cleared recording starts its bounds over
+	{
+		UVRGestureComponent * GestureComp = MakeGestureComponent(GesturesDB, false);
+		GestureComp->GestureLog.GestureSize = FBox(FVector(-50.f), FVector(50.f));
+		GestureComp->ClearRecording();
+		TestEqual(TEXT("ClearRecording resets the gesture size"), GestureComp->GestureLog.GestureSize.GetSize(), FVector::ZeroVector);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRGestureDetectionCostTest, "VRExpansionPlugin.Gestures.DetectionCost", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRGestureDetectionCostTest::RunTest(const FString & Parameters)
+{
+	using namespace VRGestureTestStatics;
+
+	UGesturesDatabase * GesturesDB = MakeGestureDB();
+	const int32 TotalTemplateLength = NumShapes * TemplateSamples;
+	const int32 NumSamples = 400;
+
+	// Idle hand near the origin, nothing gets detected so the buffer fills up, the circle ends at the origin so it always passes firstThreshold
+	TArray<FVector> Samples;
+	FRandomStream Stream(50);
+	for (int32 i = 0; i < NumSamples; ++i)
+		Samples.Add(Stream.VRand() * Stream.FRandRange(0.f, 1.f));
+
+	int32 PrevBufferedMaxCells = 0;
+	for (int32 BufferSize : { 60, 240 })
+	{
+		UVRGestureComponent * StreamingComp = MakeGestureComponent(GesturesDB, true, BufferSize);
+		UVRGestureComponent * BufferedComp = MakeGestureComponent(GesturesDB, false, BufferSize);
+
+		int32 StreamingMinCells = MAX_int32;
+		int32 StreamingMaxCells = 0;
+		int32 BufferedMaxCells = 0;
+		int64 BufferedTotalCells = 0;
+		double StreamingTime = 0.0;
+		double BufferedTime = 0.0;
+
+		for (int32 i = 0; i < Samples.Num(); ++i)
+		{
+			PushSample(StreamingComp, Samples[i]);
+			double StartTime = FPlatformTime::Seconds();
+			StreamingComp->StreamGestureSample(Samples[i]);
+			StreamingTime += FPlatformTime::Seconds() - StartTime;
+
+			StreamingMinCells = FMath::Min(StreamingMinCells, StreamingComp->LastDetectionCells);
+			StreamingMaxCells = FMath::Max(StreamingMaxCells, StreamingComp->LastDetectionCells);
+
+			PushSample(BufferedComp, Samples[i]);
+			StartTime = FPlatformTime::Seconds();
+			BufferedComp->RecognizeGesture(BufferedComp->GestureLog);
+			BufferedTime += FPlatformTime::Seconds() - StartTime;
+
+			BufferedMaxCells = FMath::Max(BufferedMaxCells, BufferedComp->LastDetectionCells);
+			BufferedTotalCells += BufferedComp->LastDetectionCells;
+		}
+
+		const FString Context = FString::Printf(TEXT("Buffer %d"), BufferSize);
+
+		// One column per template and new sample no matter how much history there is
+		TestEqual(*(Context + TEXT(": streaming evaluates one column per template every sample")), StreamingMinCells, TotalTemplateLength);
+		TestEqual(*(Context + TEXT(": streaming cost doesn't grow with the buffer")), StreamingMaxCells, TotalTemplateLength);
+		TestTrue(*(Context + TEXT(": RecognizeGesture re-runs the whole buffer")), BufferedMaxCells >= BufferSize * TemplateSamples);
+		TestTrue(*(Context + TEXT(": RecognizeGesture cost grows with the buffer")), BufferedMaxCells > PrevBufferedMaxCells);
+		PrevBufferedMaxCells = BufferedMaxCells;
+
+		AddInfo(FString::Printf(TEXT("%s: streaming %d cells %.2fus per sample | RecognizeGesture max %d mean %.0f cells %.2fus per sample"),
+			*Context, StreamingMaxCells, StreamingTime * 1000000.0 / NumSamples, BufferedMaxCells, (double)BufferedTotalCells / NumSamples, BufferedTime * 1000000.0 / NumSamples));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,123 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactibles/VRInteractibleFunctionLibrary.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/BitWriter.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRInteractibleQuantizeRoundTripTest, "VRExpansionPlugin.Interactibles.QuantizeRoundTrip", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRInteractibleQuantizeRoundTripTest::RunTest(const FString & Parameters)
+{
+	// The ranges the lever, dial, slider and button replicate with
+	const FVector2D Ranges[] = { FVector2D(-180.f, 180.f), FVector2D(0.f, 360.f), FVector2D(0.f, 1.f), FVector2D(-25.f, 0.f) };
+
+	for (const FVector2D & Range : Ranges)
+	{
+		const float MinValue = Range.X;
+		const float MaxValue = Range.Y;
+		const float MaxError = (MaxValue - MinValue) / MAX_uint16;
+		const FString Context = FString::Printf(TEXT("Range %.2f to %.2f"), MinValue, MaxValue);
+
+		TestEqual(*(Context + TEXT(": min packs to 0")), (int32)UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(MinValue, MinValue, MaxValue), 0);
+		TestEqual(*(Context + TEXT(": max packs to MAX_uint16")), (int32)UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(MaxValue, MinValue, MaxValue), (int32)MAX_uint16);
+		TestEqual(*(Context + TEXT(": min round trips exactly")), UVRInteractibleFunctionLibrary::DequantizeInteractibleValue(0, MinValue, MaxValue), MinValue);
+		TestEqual(*(Context + TEXT(": max round trips exactly")), UVRInteractibleFunctionLibrary::DequantizeInteractibleValue(MAX_uint16, MinValue, MaxValue), MaxValue);
+
+		TestEqual(*(Context + TEXT(": values under the range clamp to min")), (int32)UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(MinValue - 10.f, MinValue, MaxValue), 0);
+		TestEqual(*(Context + TEXT(": values over the range clamp to max")), (int32)UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(MaxValue + 10.f, MinValue, MaxValue), (int32)MAX_uint16);
+
+		FRandomStream Stream(1234);
+		float WorstError = 0.f;
+		int32 NumUnstable = 0;
+		for (int32 i = 0; i < 10000; ++i)
+		{
+			const float Value = Stream.FRandRange(MinValue, MaxValue);
+			const uint16 Packed = UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(Value, MinValue, MaxValue);
+			const float Unpacked = UVRInteractibleFunctionLibrary::DequantizeInteractibleValue(Packed, MinValue, MaxValue);
+
+			WorstError = FMath::Max(WorstError, FMath::Abs(Unpacked - Value));
+
+			// Re-packing an unpacked value has to land on the same step or replicated states would drift
+			if (UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(Unpacked, MinValue, MaxValue) != Packed)
+				++NumUnstable;
+		}
+
+		// Rounding to the nearest step is half a step off at most, leave some room for float precision
+		TestTrue(*(Context + TEXT(": round trip error is within half a step")), WorstError <= MaxError * 0.5f + KINDA_SMALL_NUMBER);
+		TestEqual(*(Context + TEXT(": re-packing is stable")), NumUnstable, 0);
+	}
+
+	TestEqual(TEXT("Empty range packs to 0"), (int32)UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(5.f, 1.f, 1.f), 0);
+
+	// The levers default state
+	TestEqual(TEXT("0 degrees packs to the lever default"), (int32)UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(0.f, -180.f, 180.f), 32768);
+	TestEqual(TEXT("Lever default unpacks to 0 degrees"), UVRInteractibleFunctionLibrary::DequantizeInteractibleValue(32768, -180.f, 180.f), 0.f, 360.f / MAX_uint16);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRInteractibleQuantizedStateBitsTest, "VRExpansionPlugin.Interactibles.QuantizedStateBits", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRInteractibleQuantizedStateBitsTest::RunTest(const FString & Parameters)
+{
+	// Payload of the property that changes each update, property handles and bunch headers are the same for both paths so they aren't counted
+	// Levers and dials move RelativeRotation (compressed shorts), sliders and buttons move RelativeLocation (full floats)
+	struct FInteractibleCase
+	{
+		const TCHAR * Name;
+		float MinValue;
+		float MaxValue;
+		bool bMovesRotation;
+		FVector LocationPerValue;
+	};
+
+	const FInteractibleCase Cases[] = {
+		{ TEXT("Lever"), -180.f, 180.f, true, FVector::ZeroVector },
+		{ TEXT("Dial"), 0.f, 360.f, true, FVector::ZeroVector },
+		{ TEXT("Slider"), 0.f, 1.f, false, FVector(50.f, 0.f, 0.f) }, // 50cm track
+		{ TEXT("Button"), -25.f, 0.f, false, FVector(0.f, 0.f, 1.f) }
+	};
+
+	FRandomStream Stream(41);
+	const int32 NumUpdates = 1000;
+
+	for (const FInteractibleCase & Case : Cases)
+	{
+		int64 TransformBits = 0;
+		int64 QuantizedBits = 0;
+
+		for (int32 i = 0; i < NumUpdates; ++i)
+		{
+			const float Value = Stream.FRandRange(Case.MinValue, Case.MaxValue);
+
+			FBitWriter TransformWriter(0, true);
+			if (Case.bMovesRotation)
+			{
+				FRotator RelativeRotation(0.f, Value, 0.f);
+				RelativeRotation.SerializeCompressedShort(TransformWriter);
+			}
+			else
+			{
+				FVector RelativeLocation = Case.LocationPerValue * Value;
+				TransformWriter << RelativeLocation;
+			}
+			TransformBits += TransformWriter.GetNumBits();
+
+			FBitWriter QuantizedWriter(0, true);
+			uint16 QuantizedValue = UVRInteractibleFunctionLibrary::QuantizeInteractibleValue(Value, Case.MinValue, Case.MaxValue);
+			QuantizedWriter << QuantizedValue;
+			QuantizedBits += QuantizedWriter.GetNumBits();
+		}
+
+		TestTrue(FString::Printf(TEXT("%s: quantized state is smaller than the transform"), Case.Name), QuantizedBits < TransformBits);
+
+		AddInfo(FString::Printf(TEXT("%s: %.1f bits per update through %s vs %.1f bits quantized"),
+			Case.Name, (double)TransformBits / NumUpdates, Case.bMovesRotation ? TEXT("RelativeRotation") : TEXT("RelativeLocation"), (double)QuantizedBits / NumUpdates));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
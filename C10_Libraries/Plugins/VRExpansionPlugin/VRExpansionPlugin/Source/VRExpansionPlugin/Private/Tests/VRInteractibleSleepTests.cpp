@@ -0,0 +1,282 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactibles/VRButtonComponent.h"
+#include "Interactibles/VRLeverComponent.h"
+#include "Interactibles/VRSliderComponent.h"
+#include "Components/SphereComponent.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRInteractibleSleepTestStatics
+{
+	static USceneComponent * SpawnRoot(UWorld * World, const FVector & Location)
+	{
+		AActor * Actor = World->SpawnActor<AActor>();
+		USceneComponent * Root = NewObject<USceneComponent>(Actor);
+		Root->SetMobility(EComponentMobility::Movable);
+		Root->SetWorldLocation(Location);
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+		return Root;
+	}
+
+	template<class ComponentType>
+	static ComponentType * AddInteractible(USceneComponent * Parent)
+	{
+		ComponentType * Component = NewObject<ComponentType>(Parent->GetOwner());
+		Component->SetMobility(EComponentMobility::Movable);
+		Component->SetupAttachment(Parent);
+		Component->RegisterComponent();
+		return Component;
+	}
+
+	// Stands in for a hand or a loose prop, the overlap events are sent by hand so it doesn't need collision
+	static USphereComponent * SpawnSphere(UWorld * World, const FVector & Location)
+	{
+		AActor * Actor = World->SpawnActor<AActor>();
+		USphereComponent * Sphere = NewObject<USphereComponent>(Actor);
+		Sphere->SetMobility(EComponentMobility::Movable);
+		Sphere->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Sphere->SetWorldLocation(Location);
+		Actor->SetRootComponent(Sphere);
+		Sphere->RegisterComponent();
+		return Sphere;
+	}
+
+	enum class EInteractibleRole : uint8
+	{
+		PropOnButton,
+		HandPressedButton,
+		IdleButton,
+		NudgedLever,
+		ReturningLever,
+		Slider
+	};
+
+	struct FSessionInteractible
+	{
+		UStaticMeshComponent * Component;
+		EInteractibleRole Role;
+		bool bSleepPolicy;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRInteractibleSleepTickCountTest, "VRExpansionPlugin.Interactibles.SleepTickCount", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRInteractibleSleepTickCountTest::RunTest(const FString & Parameters)
+{
+	using namespace VRInteractibleSleepTestStatics;
+
+	const int32 NumInteractibles = 2000;
+	const int32 NumHandPressed = 4;
+	const int32 NumFrames = 600;
+	const float DeltaTime = 1.f / 90.f;
+	const FVector FarAway(0.f, 0.f, -100000.f);
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+
+	FBPVRInteractibleSleepSettings SleepSettings;
+	SleepSettings.bUseSleepPolicy = true;
+	SleepSettings.MaxSettleTime = 1.0f;
+	SleepSettings.bWakeOnlyNearHands = true;
+
+	// First half runs with the default settings, second half with the sleep policy
+	TArray<FSessionInteractible> Interactibles;
+	TArray<UVRButtonComponent*> HandPressedButtons;
+	UVRButtonComponent * PolicyPropButton = nullptr;
+	USphereComponent * PolicyProp = nullptr;
+	int32 NumHandPressedInHalf[2] = { 0, 0 };
+
+	for (int32 i = 0; i < NumInteractibles; ++i)
+	{
+		const bool bSleepPolicy = i >= NumInteractibles / 2;
+		const int32 LocalIndex = i % (NumInteractibles / 2);
+		USceneComponent * Root = SpawnRoot(World, FVector((i % 50) * 100.f, (i / 50) * 100.f, 100.f));
+
+		FSessionInteractible Interactible;
+		Interactible.bSleepPolicy = bSleepPolicy;
+
+		switch (LocalIndex % 3)
+		{
+		case 0:
+		{
+			UVRButtonComponent * Button = AddInteractible<UVRButtonComponent>(Root);
+			if (bSleepPolicy)
+				Button->SleepSettings = SleepSettings;
+
+			// A button meant to be hit with anything, so a prop landing on it presses it
+			Button->bSkipOverlapFiltering = true;
+			Interactible.Component = Button;
+
+			if ((LocalIndex / 3) % 2 == 0)
+			{
+				Interactible.Role = EInteractibleRole::PropOnButton;
+				USphereComponent * Prop = SpawnSphere(World, Button->GetComponentLocation() - FVector(0.f, 0.f, 4.f));
+				Button->OnOverlapBegin(Button, Prop->GetOwner(), Prop, 0, false, FHitResult());
+
+				if (bSleepPolicy && !PolicyPropButton)
+				{
+					PolicyPropButton = Button;
+					PolicyProp = Prop;
+				}
+			}
+			else if (NumHandPressedInHalf[bSleepPolicy ? 1 : 0] < NumHandPressed)
+			{
+				Interactible.Role = EInteractibleRole::HandPressedButton;
+				HandPressedButtons.Add(Button);
+				++NumHandPressedInHalf[bSleepPolicy ? 1 : 0];
+			}
+			else
+				Interactible.Role = EInteractibleRole::IdleButton;
+		}break;
+		case 1:
+		{
+			UVRLeverComponent * Lever = AddInteractible<UVRLeverComponent>(Root);
+			if (bSleepPolicy)
+				Lever->SleepSettings = SleepSettings;
+
+			Lever->LeverRotationAxis = EVRInteractibleLeverAxis::Axis_XZ;
+			Lever->LeverReturnTypeWhenReleased = EVRInteractibleLeverReturnType::ReturnToZero;
+			Lever->SetRelativeRotation(FRotator(25.f, 0.f, 0.f));
+
+			// Let go of mid throw
+			Lever->OnGripRelease_Implementation(nullptr, FBPActorGripInformation(), false);
+			Lever->SetComponentTickEnabled(true);
+
+			Interactible.Component = Lever;
+			Interactible.Role = (LocalIndex / 3) % 2 == 0 ? EInteractibleRole::NudgedLever : EInteractibleRole::ReturningLever;
+		}break;
+		default:
+		{
+			UVRSliderComponent * Slider = AddInteractible<UVRSliderComponent>(Root);
+			if (bSleepPolicy)
+				Slider->SleepSettings = SleepSettings;
+
+			Slider->SliderBehaviorWhenReleased = EVRInteractibleSliderDropBehavior::RetainMomentum;
+			Slider->SetSliderProgress(0.5f);
+			Slider->MomentumAtDrop = 0.8f;
+			Slider->OnGripRelease_Implementation(nullptr, FBPActorGripInformation(), false);
+
+			Interactible.Component = Slider;
+			Interactible.Role = EInteractibleRole::Slider;
+		}break;
+		}
+
+		Interactibles.Add(Interactible);
+	}
+
+	// Props landed before anyone was near, nothing in the policy half should have woken for them
+	int32 NumPolicyButtonsWokenByProps = 0;
+	for (const FSessionInteractible & Interactible : Interactibles)
+	{
+		if (Interactible.bSleepPolicy && Interactible.Role == EInteractibleRole::PropOnButton && Interactible.Component->IsComponentTickEnabled())
+			++NumPolicyButtonsWokenByProps;
+	}
+	TestEqual(TEXT("Props don't wake policy buttons with no hand near"), NumPolicyButtonsWokenByProps, 0);
+
+	// Hands register the same way a motion controller does on begin play
+	TArray<USphereComponent*> Hands;
+	for (UVRButtonComponent * Button : HandPressedButtons)
+	{
+		USphereComponent * Hand = SpawnSphere(World, Button->GetComponentLocation() + FVector(0.f, 0.f, 2.f));
+		UVRInteractibleFunctionLibrary::Interactible_RegisterHand(Hand);
+		Hands.Add(Hand);
+	}
+
+	int64 NumComponentTicks = 0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		if (Frame == 0)
+		{
+			// Press in
+			for (int32 i = 0; i < Hands.Num(); ++i)
+			{
+				HandPressedButtons[i]->OnOverlapBegin(HandPressedButtons[i], Hands[i]->GetOwner(), Hands[i], 0, false, FHitResult());
+				Hands[i]->SetWorldLocation(HandPressedButtons[i]->GetComponentLocation() - FVector(0.f, 0.f, 6.f));
+			}
+		}
+		else if (Frame == 90)
+		{
+			// Pull back out
+			for (int32 i = 0; i < Hands.Num(); ++i)
+			{
+				Hands[i]->SetWorldLocation(FarAway);
+				HandPressedButtons[i]->OnOverlapEnd(HandPressedButtons[i], Hands[i]->GetOwner(), Hands[i], 0);
+			}
+		}
+		else if (Frame == 200 && PolicyPropButton && Hands.Num() > 0)
+		{
+			// A hand knocks the prop back into a policy button, then walks off and leaves it there
+			Hands[0]->SetWorldLocation(PolicyPropButton->GetComponentLocation() + FVector(0.f, 0.f, 10.f));
+			PolicyPropButton->OnOverlapBegin(PolicyPropButton, PolicyProp->GetOwner(), PolicyProp, 0, false, FHitResult());
+			TestTrue(TEXT("Prop wakes a policy button while a hand is near"), PolicyPropButton->IsComponentTickEnabled());
+		}
+		else if (Frame == 300 && Hands.Num() > 0)
+		{
+			Hands[0]->SetWorldLocation(FarAway);
+		}
+
+		// Resting against something that holds them off of zero
+		for (const FSessionInteractible & Interactible : Interactibles)
+		{
+			if (Interactible.Role == EInteractibleRole::NudgedLever)
+				Interactible.Component->SetRelativeRotation(FRotator(10.f, 0.f, 0.f));
+		}
+
+		World->Tick(LEVELTICK_All, DeltaTime);
+		++GFrameCounter;
+
+		for (const FSessionInteractible & Interactible : Interactibles)
+			NumComponentTicks += Interactible.Component->IsComponentTickEnabled() ? 1 : 0;
+	}
+
+	for (USphereComponent * Hand : Hands)
+		UVRInteractibleFunctionLibrary::Interactible_UnregisterHand(Hand);
+
+	// Still ticking after the session, by half and role
+	const TCHAR * RoleNames[] = { TEXT("prop buttons"), TEXT("hand pressed buttons"), TEXT("idle buttons"), TEXT("nudged levers"), TEXT("returning levers"), TEXT("sliders") };
+	const int32 NumRoles = ARRAY_COUNT(RoleNames);
+	int32 Ticking[2][NumRoles] = {};
+	int32 Total[2][NumRoles] = {};
+
+	for (const FSessionInteractible & Interactible : Interactibles)
+	{
+		++Total[Interactible.bSleepPolicy ? 1 : 0][(int32)Interactible.Role];
+		Ticking[Interactible.bSleepPolicy ? 1 : 0][(int32)Interactible.Role] += Interactible.Component->IsComponentTickEnabled() ? 1 : 0;
+	}
+
+	for (int32 Half = 0; Half < 2; ++Half)
+	{
+		FString Line = FString::Printf(TEXT("%s:"), Half == 0 ? TEXT("Default settings") : TEXT("Sleep policy"));
+		int32 NumTicking = 0;
+		for (int32 Role = 0; Role < NumRoles; ++Role)
+		{
+			Line += FString::Printf(TEXT(" %d/%d %s"), Ticking[Half][Role], Total[Half][Role], RoleNames[Role]);
+			NumTicking += Ticking[Half][Role];
+		}
+
+		AddInfo(FString::Printf(TEXT("%s | %d of %d still ticking after %d frames"), *Line, NumTicking, NumInteractibles / 2, NumFrames));
+	}
+
+	AddInfo(FString::Printf(TEXT("%lld component ticks over the session"), NumComponentTicks));
+
+	// Without the policy whatever is held off of rest keeps ticking, that is what the policy is for
+	TestEqual(TEXT("Default buttons with a prop on them keep ticking"), Ticking[0][(int32)EInteractibleRole::PropOnButton], Total[0][(int32)EInteractibleRole::PropOnButton]);
+	TestEqual(TEXT("Default nudged levers keep ticking"), Ticking[0][(int32)EInteractibleRole::NudgedLever], Total[0][(int32)EInteractibleRole::NudgedLever]);
+
+	for (int32 Role = 0; Role < NumRoles; ++Role)
+		TestEqual(*FString::Printf(TEXT("Sleep policy %s are asleep after the session"), RoleNames[Role]), Ticking[1][Role], 0);
+
+	// Things that settle on their own settle either way
+	TestEqual(TEXT("Default hand pressed buttons are asleep"), Ticking[0][(int32)EInteractibleRole::HandPressedButton], 0);
+	TestEqual(TEXT("Default returning levers are asleep"), Ticking[0][(int32)EInteractibleRole::ReturningLever], 0);
+	TestEqual(TEXT("Default sliders are asleep"), Ticking[0][(int32)EInteractibleRole::Slider], 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,88 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRLogComponent.h"
+#include "Engine/World.h"
+#include "RenderingThread.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRLogComponentRedrawTest, "VRExpansionPlugin.Log.OutputLogRedraws", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Meant to be run with -nullrhi, the canvas items are still submitted so they can be counted
+bool FVRLogComponentRedrawTest::RunTest(const FString & Parameters)
+{
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	AActor * Actor = World->SpawnActor<AActor>();
+	UVRLogComponent * LogComp = NewObject<UVRLogComponent>(Actor);
+	LogComp->RegisterComponent();
+
+	// Only the lines the test writes, anything else logging in the background would dirty it
+	GLog->RemoveOutputDevice(&LogComp->OutputLogHistory);
+
+	for (int32 i = 0; i < 200; ++i)
+		LogComp->OutputLogHistory.Log(ELogVerbosity::Log, *FString::Printf(TEXT("Static line %d"), i));
+
+	UTextureRenderTarget2D * Target = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+	Target->InitAutoFormat(512, 512);
+	Target->UpdateResourceImmediate(true);
+
+	const int32 NumFrames = 300;
+	const EBPVRConsoleDrawType DrawType = EBPVRConsoleDrawType::VRConsole_Draw_OutputLogOnly;
+
+	// Static log, drawn once and then left alone
+	int32 StaticRedraws = 0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		StaticRedraws += LogComp->DrawConsoleToRenderTarget2D(DrawType, Target, 0.f, false) ? 1 : 0;
+
+	const int32 ItemsPerRedraw = LogComp->OutputLogDrawItemCount;
+
+	TestEqual(TEXT("Static log is only drawn once"), StaticRedraws, 1);
+	TestTrue(TEXT("A redraw draws the background and the visible lines"), ItemsPerRedraw > 1);
+
+	// The same frames forced, what drawing every call costs
+	const int32 ItemsBeforeForced = LogComp->OutputLogDrawItemCount;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		LogComp->DrawConsoleToRenderTarget2D(DrawType, Target, 0.f, true);
+	const int32 ForcedItems = LogComp->OutputLogDrawItemCount - ItemsBeforeForced;
+
+	// A line appended every 10 frames
+	const int32 ItemsBeforeAppend = LogComp->OutputLogDrawItemCount;
+	int32 AppendRedraws = 0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		if (Frame % 10 == 0)
+			LogComp->OutputLogHistory.Log(ELogVerbosity::Warning, *FString::Printf(TEXT("Appended line %d"), Frame));
+
+		AppendRedraws += LogComp->DrawConsoleToRenderTarget2D(DrawType, Target, 0.f, false) ? 1 : 0;
+	}
+	const int32 AppendItems = LogComp->OutputLogDrawItemCount - ItemsBeforeAppend;
+
+	TestEqual(TEXT("Appended log is redrawn once per new line"), AppendRedraws, NumFrames / 10);
+
+	// Scrolling redraws, holding the scroll position doesn't
+	int32 ScrollRedraws = 0;
+	for (int32 Frame = 0; Frame < 20; ++Frame)
+		ScrollRedraws += LogComp->DrawConsoleToRenderTarget2D(DrawType, Target, 0.05f * (Frame / 2 + 1), false) ? 1 : 0;
+
+	TestEqual(TEXT("Scrolling redraws once per new scroll position"), ScrollRedraws, 10);
+
+	// Same scroll on a new target has to draw
+	UTextureRenderTarget2D * OtherTarget = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+	OtherTarget->InitAutoFormat(512, 512);
+	OtherTarget->UpdateResourceImmediate(true);
+	TestTrue(TEXT("New render target is drawn"), LogComp->DrawConsoleToRenderTarget2D(DrawType, OtherTarget, 0.5f, false));
+
+	AddInfo(FString::Printf(TEXT("%d frames static: %d redraws, %d canvas items (%d when forced every frame) | appended every 10 frames: %d redraws, %d canvas items"),
+		NumFrames, StaticRedraws, ItemsPerRedraw, ForcedItems, AppendRedraws, AppendItems));
+
+	FlushRenderingCommands();
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,260 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Interactibles/VRMountComponent.h"
+#include "GripMotionControllerComponent.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRMountTestStatics
+{
+	static USceneComponent * SpawnRoot(UWorld * World, const FTransform & Transform)
+	{
+		AActor * Actor = World->SpawnActor<AActor>();
+		USceneComponent * Root = NewObject<USceneComponent>(Actor);
+		Root->SetMobility(EComponentMobility::Movable);
+		Root->SetWorldTransform(Transform);
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+		return Root;
+	}
+
+	template<class ComponentType>
+	static ComponentType * AddComponent(USceneComponent * Parent, const FTransform & RelativeTransform = FTransform::Identity)
+	{
+		ComponentType * Component = NewObject<ComponentType>(Parent->GetOwner());
+		Component->SetMobility(EComponentMobility::Movable);
+		Component->SetupAttachment(Parent);
+		Component->SetRelativeTransform(RelativeTransform);
+		Component->RegisterComponent();
+		return Component;
+	}
+
+	// The XZ solve as it was before it moved to quaternions, outside of the flip zones
+	struct FRotatorMountSolve
+	{
+		FVector InitialGripToForwardVec;
+
+		// Same vector OnGrip builds, unrotated by the euler frame
+		void OnGrip(const UVRMountComponent * Mount)
+		{
+			const FVector GripToForwardVec = Mount->GrippedOnBack ? Mount->InitialForwardVector + Mount->InitialInteractorLocation : Mount->InitialForwardVector - Mount->InitialInteractorLocation;
+			InitialGripToForwardVec = FRotator(Mount->RelativeRotation.Pitch, Mount->RelativeRotation.Yaw, Mount->TwistDiff).UnrotateVector(GripToForwardVec);
+		}
+
+		// Returns the un-rolled relative rotation and the interactor location the flip angle is taken from
+		FRotator Solve(UVRMountComponent * Mount, const FVector & PivotLocation, FVector & OutInteractorLocation) const
+		{
+			FTransform CurrentRelativeTransform = Mount->InitialRelativeTransform * UVRInteractibleFunctionLibrary::Interactible_GetCurrentParentTransform(Mount);
+			FVector CurInteractorLocation = CurrentRelativeTransform.InverseTransformPosition(PivotLocation);
+
+			if (Mount->GrippedOnBack)
+				CurInteractorLocation = CurInteractorLocation * -1;
+
+			FVector CurToForwardAxisVec = FRotator(Mount->RelativeRotation.Pitch, Mount->RelativeRotation.Yaw, Mount->TwistDiff).RotateVector(InitialGripToForwardVec);
+			CurInteractorLocation = (CurInteractorLocation.GetSafeNormal() * Mount->InitialInteractorLocation.Size() + CurToForwardAxisVec).GetSafeNormal()*CurInteractorLocation.Size();
+			OutInteractorLocation = CurInteractorLocation;
+
+			FRotator Rot = CurInteractorLocation.GetSafeNormal().Rotation();
+			return (FTransform(FRotator(Rot.Pitch, Rot.Yaw, 0))*Mount->InitialRelativeTransform).Rotator();
+		}
+
+		// Final relative rotation the old tick ended up with
+		FQuat GetExpectedRotation(UVRMountComponent * Mount, const FVector & PivotLocation) const
+		{
+			FVector InteractorLocation;
+			return Solve(Mount, PivotLocation, InteractorLocation).Quaternion() * FRotator(0, 0, -Mount->TwistDiff).Quaternion();
+		}
+
+		// Applied the way the old tick did, set and then a local roll on top
+		void Tick(UVRMountComponent * Mount, const FVector & PivotLocation) const
+		{
+			FVector InteractorLocation;
+			Mount->SetRelativeRotation(Solve(Mount, PivotLocation, InteractorLocation));
+
+			// Only used in the flip zones, still paid every tick
+			FVector nAxis;
+			float FlipAngle;
+			FQuat::FindBetweenVectors(FVector(0, 0, 1), InteractorLocation.GetSafeNormal()).ToAxisAndAngle(nAxis, FlipAngle);
+
+			Mount->AddLocalRotation(FRotator(0, 0, -Mount->TwistDiff));
+		}
+	};
+
+	// Hand somewhere around the mount, kept out of the top and bottom flip cones
+	static FVector GetHandLocation(const UVRMountComponent * Mount, float Yaw, float Pitch, float Distance)
+	{
+		const FTransform CurrentRelativeTransform = Mount->InitialRelativeTransform * UVRInteractibleFunctionLibrary::Interactible_GetCurrentParentTransform(const_cast<UVRMountComponent *>(Mount));
+		return CurrentRelativeTransform.TransformPosition(FRotator(Pitch, Yaw, 0.f).Vector() * Distance);
+	}
+
+	static void GripAt(UVRMountComponent * Mount, UGripMotionControllerComponent * Controller, const FVector & HandLocation, FBPActorGripInformation & OutGrip)
+	{
+		Controller->SetWorldLocation(HandLocation);
+		OutGrip = FBPActorGripInformation();
+		OutGrip.RelativeTransform = Mount->GetComponentTransform().GetRelativeTransform(Controller->GetComponentTransform());
+		Mount->OnGrip_Implementation(Controller, OutGrip);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMountQuatSolveTest, "VRExpansionPlugin.Mount.QuatSolveMatchesRotatorSolve", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRMountQuatSolveTest::RunTest(const FString & Parameters)
+{
+	using namespace VRMountTestStatics;
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	FRandomStream Stream(48);
+
+	USceneComponent * ControllerRoot = SpawnRoot(World, FTransform::Identity);
+	UGripMotionControllerComponent * Controller = AddComponent<UGripMotionControllerComponent>(ControllerRoot);
+	Controller->bUseWithoutTracking = true;
+
+	const int32 NumGrips = 50;
+	const int32 NumTicksPerGrip = 120;
+
+	float MaxAngleError = 0.f;
+	float MaxFlipAngleError = 0.f;
+	int32 NumFlipZoneTicks = 0;
+
+	for (int32 GripIndex = 0; GripIndex < NumGrips; ++GripIndex)
+	{
+		// Mounts on tilted parents with a rotated rest pose
+		USceneComponent * Parent = SpawnRoot(World, FTransform(FRotator(Stream.FRandRange(-60.f, 60.f), Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-60.f, 60.f)), Stream.VRand() * 200.f));
+		UVRMountComponent * Mount = AddComponent<UVRMountComponent>(Parent, FTransform(FRotator(Stream.FRandRange(-30.f, 30.f), Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-30.f, 30.f))));
+		Mount->BreakDistance = 0.f;
+
+		// Every other grip is on the back of the mount
+		float HandYaw = (GripIndex % 2 ? 180.f : 0.f) + Stream.FRandRange(-60.f, 60.f);
+		float HandPitch = Stream.FRandRange(-35.f, 35.f);
+		const float HandDistance = Stream.FRandRange(20.f, 60.f);
+
+		FBPActorGripInformation Grip;
+		GripAt(Mount, Controller, GetHandLocation(Mount, HandYaw, HandPitch, HandDistance), Grip);
+
+		FRotatorMountSolve RotatorSolve;
+		RotatorSolve.OnGrip(Mount);
+
+		for (int32 Tick = 0; Tick < NumTicksPerGrip; ++Tick)
+		{
+			// Something else moves the mount half way through, the next tick has to start from it
+			if (Tick == NumTicksPerGrip / 2)
+				Mount->SetRelativeRotation(Mount->RelativeRotation + FRotator(Stream.FRandRange(-10.f, 10.f), Stream.FRandRange(-30.f, 30.f), 0.f));
+
+			HandYaw += Stream.FRandRange(-4.f, 4.f);
+			HandPitch = FMath::Clamp(HandPitch + Stream.FRandRange(-3.f, 3.f), -35.f, 35.f);
+			Controller->SetWorldLocation(GetHandLocation(Mount, HandYaw, HandPitch, HandDistance));
+
+			const FQuat Expected = RotatorSolve.GetExpectedRotation(Mount, Controller->GetPivotLocation());
+			Mount->TickGrip_Implementation(Controller, Grip, 1.f / 90.f);
+
+			// The flip zone keeps its own interpolated state, the reference only covers the plain solve
+			if (Mount->bIsInsideFrontFlipingZone || Mount->bIsInsideBackFlipZone || Mount->bLerpingOutOfFlipZone || Mount->bFirstEntryToHalfFlipZone)
+			{
+				++NumFlipZoneTicks;
+				continue;
+			}
+
+			MaxAngleError = FMath::Max(MaxAngleError, FMath::RadiansToDegrees(Expected.AngularDistance(Mount->RelativeRotation.Quaternion())));
+		}
+
+		Mount->OnGripRelease_Implementation(Controller, Grip, false);
+		Parent->GetOwner()->Destroy();
+	}
+
+	// The flip angle is also used at the poles, so it is checked over every direction
+	for (int32 i = 0; i < 10000; ++i)
+	{
+		const FVector Direction = Stream.VRand();
+
+		FVector nAxis;
+		float RotatorFlipAngle;
+		FQuat::FindBetweenVectors(FVector(0, 0, 1), Direction).ToAxisAndAngle(nAxis, RotatorFlipAngle);
+		const float FlipAngle = FMath::Acos(FMath::Clamp(Direction.Z, -1.0f, 1.0f));
+
+		MaxFlipAngleError = FMath::Max(MaxFlipAngleError, FMath::Abs(RotatorFlipAngle - FlipAngle));
+	}
+
+	TestTrue(TEXT("Most poses stay out of the flip zones"), NumFlipZoneTicks < NumGrips * NumTicksPerGrip / 10);
+	TestTrue(TEXT("Quaternion solve matches the FRotator solve"), MaxAngleError < 0.05f);
+	TestTrue(TEXT("Flip angle matches FindBetweenVectors"), MaxFlipAngleError < 0.001f);
+
+	AddInfo(FString::Printf(TEXT("%d grips x %d ticks (%d in the flip zones): max rotation difference %.4f degrees, max flip angle difference %.6f radians"), NumGrips, NumTicksPerGrip, NumFlipZoneTicks, MaxAngleError, MaxFlipAngleError));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRMountTickGripCostTest, "VRExpansionPlugin.Mount.TickGripCost", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRMountTickGripCostTest::RunTest(const FString & Parameters)
+{
+	using namespace VRMountTestStatics;
+
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	USceneComponent * ControllerRoot = SpawnRoot(World, FTransform::Identity);
+	UGripMotionControllerComponent * Controller = AddComponent<UGripMotionControllerComponent>(ControllerRoot);
+	Controller->bUseWithoutTracking = true;
+
+	// A mounted weapon with a few attached parts, each transform update walks them
+	USceneComponent * Parent = SpawnRoot(World, FTransform(FRotator(0.f, 30.f, 0.f), FVector(100.f, 0.f, 100.f)));
+	UVRMountComponent * Mount = AddComponent<UVRMountComponent>(Parent);
+	Mount->BreakDistance = 0.f;
+	for (int32 i = 0; i < 4; ++i)
+		AddComponent<UStaticMeshComponent>(Mount, FTransform(FVector(10.f * (i + 1), 0.f, 0.f)));
+
+	const int32 NumTicks = 20000;
+	double Seconds[2] = { 0.0, 0.0 };
+
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bRotatorSolve = Pass == 0;
+
+		// Same hand path for both
+		FRandomStream Stream(480);
+		float HandYaw = 0.f;
+		float HandPitch = 0.f;
+
+		Mount->SetRelativeRotation(FRotator::ZeroRotator);
+		FBPActorGripInformation Grip;
+		GripAt(Mount, Controller, GetHandLocation(Mount, HandYaw, HandPitch, 40.f), Grip);
+
+		FRotatorMountSolve RotatorSolve;
+		RotatorSolve.OnGrip(Mount);
+
+		for (int32 Tick = 0; Tick < NumTicks; ++Tick)
+		{
+			HandYaw += Stream.FRandRange(-4.f, 4.f);
+			HandPitch = FMath::Clamp(HandPitch + Stream.FRandRange(-3.f, 3.f), -35.f, 35.f);
+			Controller->SetWorldLocation(GetHandLocation(Mount, HandYaw, HandPitch, 40.f));
+
+			const double StartTime = FPlatformTime::Seconds();
+
+			if (bRotatorSolve)
+				RotatorSolve.Tick(Mount, Controller->GetPivotLocation());
+			else
+				Mount->TickGrip_Implementation(Controller, Grip, 1.f / 90.f);
+
+			Seconds[Pass] += FPlatformTime::Seconds() - StartTime;
+		}
+
+		Mount->OnGripRelease_Implementation(Controller, Grip, false);
+	}
+
+	// Timing only, too noisy on shared machines to fail on
+	AddInfo(FString::Printf(TEXT("%d ticks with 4 children: FRotator solve %.3fus per tick, quaternion solve %.3fus per tick (%.2fx)"),
+		NumTicks, Seconds[0] * 1000000.0 / NumTicks, Seconds[1] * 1000000.0 / NumTicks, Seconds[1] > 0.0 ? Seconds[0] / Seconds[1] : 0.0));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
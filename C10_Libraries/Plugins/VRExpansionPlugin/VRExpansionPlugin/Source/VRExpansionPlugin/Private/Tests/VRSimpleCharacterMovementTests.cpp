@@ -0,0 +1,88 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SimpleChar/VRSimpleCharacterMovementComponent.h"
+#include "SimpleChar/VRSimpleCharacter.h"
+#include "ReplicatedVRCameraComponent.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/VRExpansionBenchmark.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRSimpleCharacterIdleTransformUpdatesTest, "VRExpansionPlugin.SimpleCharacter.IdleTransformUpdates", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+// Meant to be run without a headset, the camera is moved by hand like a 2D pawn would
+bool FVRSimpleCharacterIdleTransformUpdatesTest::RunTest(const FString & Parameters)
+{
+	FVRBenchmarkWorld BenchWorld;
+	UWorld * World = BenchWorld.GetWorld();
+	if (!TestNotNull(TEXT("Benchmark world"), World))
+		return false;
+
+	BenchWorld.SpawnFloor();
+
+	AVRSimpleCharacter * Character = World->SpawnActor<AVRSimpleCharacter>(AVRSimpleCharacter::StaticClass(), FTransform(FVector(0.f, 0.f, 100.f)));
+	UVRSimpleCharacterMovementComponent * Movement = Character ? Cast<UVRSimpleCharacterMovementComponent>(Character->GetCharacterMovement()) : nullptr;
+	if (!Movement)
+	{
+		AddError(TEXT("Failed to spawn a simple character"));
+		return false;
+	}
+
+	// Locally controlled so the HMD follow runs
+	Character->SpawnDefaultController();
+	if (!Character->Controller)
+	{
+		AddError(TEXT("Simple character has no AI controller class to possess it with"));
+		return false;
+	}
+
+	// Every propagation that reaches the camera and the hands, not just the ones the movement component makes itself
+	int32 NumPropagations = 0;
+	auto CountPropagation = [&NumPropagations](USceneComponent*, EUpdateTransformFlags, ETeleportType) { ++NumPropagations; };
+	Character->VRReplicatedCamera->TransformUpdated.AddLambda(CountPropagation);
+	Character->LeftMotionController->TransformUpdated.AddLambda(CountPropagation);
+	Character->RightMotionController->TransformUpdated.AddLambda(CountPropagation);
+
+	const float DeltaTime = 1.f / 90.f;
+	const int32 NumFrames = 300;
+
+	// Let it land and settle on the floor first
+	for (int32 Frame = 0; Frame < 60; ++Frame)
+		World->Tick(LEVELTICK_All, DeltaTime);
+
+	// Idle, nothing moves
+	Movement->NumTransformPushes = 0;
+	Movement->NumOffsetToWorldUpdates = 0;
+	NumPropagations = 0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		World->Tick(LEVELTICK_All, DeltaTime);
+
+	const int32 IdlePropagations = NumPropagations;
+	TestEqual(TEXT("Idle player pushes no transforms"), Movement->NumTransformPushes, 0);
+	TestEqual(TEXT("Idle player doesn't regenerate its offset"), Movement->NumOffsetToWorldUpdates, 0);
+
+	AddInfo(FString::Printf(TEXT("Idle: %d frames, %d transform pushes, %d offset regenerations, %d propagations to the camera and hands"),
+		NumFrames, Movement->NumTransformPushes, Movement->NumOffsetToWorldUpdates, IdlePropagations));
+
+	// The camera moved off of the capsule each frame, every frame has to snap it back and follow
+	Movement->NumTransformPushes = 0;
+	Movement->NumOffsetToWorldUpdates = 0;
+	NumPropagations = 0;
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		const FVector CameraLoc = Character->VRReplicatedCamera->RelativeLocation;
+		Character->VRReplicatedCamera->SetRelativeLocation(FVector(2.f, 0.f, CameraLoc.Z));
+		World->Tick(LEVELTICK_All, DeltaTime);
+	}
+
+	TestEqual(TEXT("Moved camera is snapped back every frame"), Movement->NumTransformPushes, NumFrames);
+	TestTrue(TEXT("Idle player propagates less than a moving one"), IdlePropagations < NumPropagations);
+
+	AddInfo(FString::Printf(TEXT("Moving camera: %d frames, %d transform pushes, %d offset regenerations, %d propagations to the camera and hands"),
+		NumFrames, Movement->NumTransformPushes, Movement->NumOffsetToWorldUpdates, NumPropagations));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "VRStereoWidgetComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRStereoWidgetTestStatics
+{
+	// Compositor that only counts what it is asked to do
+	class FStubStereoLayers : public IStereoLayers
+	{
+	public:
+
+		int32 NumCreates = 0;
+		int32 NumDestroys = 0;
+		int32 NumSetLayerDescs = 0;
+		int32 NumTextureUpdates = 0;
+
+		virtual uint32 CreateLayer(const FLayerDesc& InLayerDesc) override { return ++NumCreates; }
+		virtual void DestroyLayer(uint32 LayerId) override { ++NumDestroys; }
+		virtual void SetLayerDesc(uint32 LayerId, const FLayerDesc& InLayerDesc) override { ++NumSetLayerDescs; }
+		virtual bool GetLayerDesc(uint32 LayerId, FLayerDesc& OutLayerDesc) override { return false; }
+		virtual void MarkTextureForUpdate(uint32 LayerId) override { ++NumTextureUpdates; }
+		virtual bool ShouldCopyDebugLayersToSpectatorScreen() const override { return false; }
+	};
+
+	// Head tracking noise, well under the default tolerances
+	static FTransform GetJitteredTransform(FRandomStream & Stream, const FTransform & Base)
+	{
+		const FRotator RotJitter(Stream.FRandRange(-0.002f, 0.002f), Stream.FRandRange(-0.002f, 0.002f), Stream.FRandRange(-0.002f, 0.002f));
+		const FVector LocJitter(Stream.FRandRange(-0.002f, 0.002f), Stream.FRandRange(-0.002f, 0.002f), Stream.FRandRange(-0.002f, 0.002f));
+		return FTransform(RotJitter.Quaternion() * Base.GetRotation(), Base.GetLocation() + LocJitter);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRStereoWidgetLayerUpdatesTest, "VRExpansionPlugin.StereoWidget.LayerUpdates", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRStereoWidgetLayerUpdatesTest::RunTest(const FString & Parameters)
+{
+	using namespace VRStereoWidgetTestStatics;
+
+	FStubStereoLayers StereoLayers;
+	UVRStereoWidgetComponent * WidgetComp = NewObject<UVRStereoWidgetComponent>(GetTransientPackage());
+
+	FRandomStream Stream(40);
+	const FTransform Base(FRotator(-10.f, 30.f, 0.f), FVector(80.f, 0.f, -20.f));
+	const int32 NumFrames = 900;
+
+	// Still widget in front of a still head, the widget redraws at 9hz
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		WidgetComp->UpdateStereoLayer(StereoLayers, GetJitteredTransform(Stream, Base), true, Frame % 10 == 0);
+
+	TestEqual(TEXT("Layer is created once"), StereoLayers.NumCreates, 1);
+	TestEqual(TEXT("Jitter doesn't re-send the layer"), StereoLayers.NumSetLayerDescs, 0);
+	TestEqual(TEXT("Texture only updates on redrawn frames"), StereoLayers.NumTextureUpdates, NumFrames / 10);
+
+	AddInfo(FString::Printf(TEXT("Idle: %d frames, %d SetLayerDesc, %d texture updates"), NumFrames, StereoLayers.NumSetLayerDescs, StereoLayers.NumTextureUpdates));
+
+	// Turning the head, every frame is a real change
+	const int32 NumTurnFrames = 90;
+	const int32 SetLayerDescsBefore = StereoLayers.NumSetLayerDescs;
+	const int32 TextureUpdatesBefore = StereoLayers.NumTextureUpdates;
+	for (int32 Frame = 1; Frame <= NumTurnFrames; ++Frame)
+		WidgetComp->UpdateStereoLayer(StereoLayers, FTransform(FRotator(0.f, 0.5f * Frame, 0.f)) * Base, true, false);
+
+	TestEqual(TEXT("Turning re-sends the layer every frame"), StereoLayers.NumSetLayerDescs - SetLayerDescsBefore, NumTurnFrames);
+	TestEqual(TEXT("Moving the layer doesn't update the texture"), StereoLayers.NumTextureUpdates - TextureUpdatesBefore, 0);
+
+	// Small steady turn under the rotation tolerance each frame, still adds up against the last sent pose
+	{
+		WidgetComp->LayerRotationTolerance = 0.45f;
+		const int32 SlowTurnBefore = StereoLayers.NumSetLayerDescs;
+		const FTransform SlowBase = FTransform(FRotator(0.f, 0.5f * NumTurnFrames, 0.f)) * Base;
+		for (int32 Frame = 1; Frame <= NumTurnFrames; ++Frame)
+			WidgetComp->UpdateStereoLayer(StereoLayers, FTransform(FRotator(0.f, 0.1f * Frame, 0.f)) * SlowBase, true, false);
+
+		// Every fifth frame is 0.5 degrees past the last one sent
+		const int32 NumSlowSends = StereoLayers.NumSetLayerDescs - SlowTurnBefore;
+		TestEqual(TEXT("Slow turn is re-sent each time it passes the tolerance"), NumSlowSends, NumTurnFrames / 5);
+		AddInfo(FString::Printf(TEXT("Slow turn: %d frames, %d SetLayerDesc with a %.2f degree tolerance"), NumTurnFrames, NumSlowSends, WidgetComp->LayerRotationTolerance));
+	}
+
+	WidgetComp->UpdateStereoLayer(StereoLayers, Base, false, false);
+	TestEqual(TEXT("Hiding destroys the layer"), StereoLayers.NumDestroys, 1);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,189 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "GripMotionControllerComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VelocityHistoryTestStatics
+{
+	struct FTestSample
+	{
+		double TimeStamp;
+		FVector Location;
+	};
+
+	// Straight least squares slope in double precision over the newest samples within the window
+	static FVector GetReferenceVelocity(const TArray<FTestSample> & Samples, float TimeWindow)
+	{
+		const double NewestTime = Samples.Last().TimeStamp;
+
+		TArray<FTestSample> InWindow;
+		for (int32 i = Samples.Num() - 1; i >= 0 && InWindow.Num() < VR_VELOCITY_HISTORY_MAX_SAMPLES; --i)
+		{
+			if (InWindow.Num() > 0 && NewestTime - Samples[i].TimeStamp > TimeWindow)
+				break;
+
+			InWindow.Add(Samples[i]);
+		}
+
+		double MeanTime = 0.0;
+		double Mean[3] = { 0.0, 0.0, 0.0 };
+		for (const FTestSample & Sample : InWindow)
+		{
+			MeanTime += Sample.TimeStamp;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+				Mean[Axis] += Sample.Location[Axis];
+		}
+
+		MeanTime /= InWindow.Num();
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+			Mean[Axis] /= InWindow.Num();
+
+		double TimeVariance = 0.0;
+		double Covariance[3] = { 0.0, 0.0, 0.0 };
+		for (const FTestSample & Sample : InWindow)
+		{
+			const double TimeDelta = Sample.TimeStamp - MeanTime;
+			TimeVariance += TimeDelta * TimeDelta;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+				Covariance[Axis] += (Sample.Location[Axis] - Mean[Axis]) * TimeDelta;
+		}
+
+		return FVector(Covariance[0] / TimeVariance, Covariance[1] / TimeVariance, Covariance[2] / TimeVariance);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRVelocityHistoryLeastSquaresTest, "VRExpansionPlugin.VelocityHistory.LeastSquaresFit", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRVelocityHistoryLeastSquaresTest::RunTest(const FString & Parameters)
+{
+	using namespace VelocityHistoryTestStatics;
+
+	FVector Velocity;
+	FRandomStream Stream(42);
+
+	// Not enough samples
+	{
+		FVRVelocityHistory History;
+		TestFalse(TEXT("Empty history has no velocity"), History.GetLinearVelocity(0.1f, Velocity));
+		TestFalse(TEXT("Empty history has no last frame velocity"), History.GetLastFrameVelocity(Velocity));
+
+		History.AddSample(1.0, FVector(10.f, 0.f, 0.f), FQuat::Identity);
+		TestFalse(TEXT("A single sample has no velocity"), History.GetLinearVelocity(0.1f, Velocity));
+		TestFalse(TEXT("A single sample has no last frame velocity"), History.GetLastFrameVelocity(Velocity));
+	}
+
+	// Constant velocity with uneven frame times is recovered exactly, also runs the ring buffer around a few times
+	{
+		const FVector ExpectedVelocity(120.f, -40.f, 300.f);
+		const FVector StartLocation(5000.f, -2000.f, 150.f);
+
+		FVRVelocityHistory History;
+		double Time = 100.0;
+		for (int32 i = 0; i < VR_VELOCITY_HISTORY_MAX_SAMPLES * 3 + 7; ++i)
+		{
+			Time += Stream.FRandRange(1.f / 120.f, 1.f / 60.f);
+			History.AddSample(Time, StartLocation + ExpectedVelocity * (float)(Time - 100.0), FQuat::Identity);
+		}
+
+		TestEqual(TEXT("History is capped at the max sample count"), History.Num(), VR_VELOCITY_HISTORY_MAX_SAMPLES);
+		TestTrue(TEXT("Constant velocity fits"), History.GetLinearVelocity(0.1f, Velocity));
+		TestTrue(TEXT("Constant velocity is recovered"), Velocity.Equals(ExpectedVelocity, 0.5f));
+		TestTrue(TEXT("Last frame velocity has the constant velocity"), History.GetLastFrameVelocity(Velocity) && Velocity.Equals(ExpectedVelocity, 0.5f));
+	}
+
+	// Only samples inside of the window count
+	{
+		const FVector OldVelocity(-500.f, 0.f, 0.f);
+		const FVector NewVelocity(0.f, 200.f, 50.f);
+
+		FVRVelocityHistory History;
+		FVector Location = FVector::ZeroVector;
+		double Time = 0.0;
+		for (int32 i = 0; i < 30; ++i)
+		{
+			Time += 1.0 / 90.0;
+			Location += (i < 20 ? OldVelocity : NewVelocity) / 90.f;
+			History.AddSample(Time, Location, FQuat::Identity);
+		}
+
+		// 0.05 seconds at 90htz is the newest 5 samples, all after the change
+		TestTrue(TEXT("Windowed velocity fits"), History.GetLinearVelocity(0.05f, Velocity));
+		TestTrue(TEXT("Samples before the window are ignored"), Velocity.Equals(NewVelocity, 0.5f));
+	}
+
+	// Noisy tracking matches a double precision least squares fit and beats the single frame difference
+	{
+		const FVector TrueVelocity(80.f, 150.f, -60.f);
+
+		TArray<FTestSample> Samples;
+		FVRVelocityHistory History;
+		double Time = 0.0;
+		for (int32 i = 0; i < 45; ++i)
+		{
+			Time += 1.0 / 90.0;
+
+			FTestSample Sample;
+			Sample.TimeStamp = Time;
+			Sample.Location = FVector(0.f, 0.f, 120.f) + TrueVelocity * (float)Time + Stream.VRand() * Stream.FRandRange(0.f, 0.5f);
+			Samples.Add(Sample);
+
+			History.AddSample(Sample.TimeStamp, Sample.Location, FQuat::Identity);
+		}
+
+		const FVector Reference = GetReferenceVelocity(Samples, 0.1f);
+		FVector LastFrameVelocity;
+
+		TestTrue(TEXT("Noisy velocity fits"), History.GetLinearVelocity(0.1f, Velocity));
+		TestTrue(TEXT("Fit matches the reference least squares fit"), Velocity.Equals(Reference, 0.5f));
+		TestTrue(TEXT("Noisy last frame velocity exists"), History.GetLastFrameVelocity(LastFrameVelocity));
+		TestTrue(TEXT("Fit is closer to the true velocity than the last frame"), FVector::Dist(Velocity, TrueVelocity) < FVector::Dist(LastFrameVelocity, TrueVelocity));
+	}
+
+	// Constant spin is recovered in degrees per second
+	{
+		const float DegreesPerSecond = 270.f;
+
+		FVRVelocityHistory History;
+		double Time = 0.0;
+		for (int32 i = 0; i < 20; ++i)
+		{
+			Time += 1.0 / 90.0;
+			History.AddSample(Time, FVector::ZeroVector, FQuat(FVector::UpVector, FMath::DegreesToRadians(DegreesPerSecond * (float)Time)));
+		}
+
+		FVector AngularVelocity;
+		TestTrue(TEXT("Angular velocity fits"), History.GetAngularVelocity(0.1f, AngularVelocity));
+		TestTrue(TEXT("Angular velocity is recovered"), AngularVelocity.Equals(FVector(0.f, 0.f, DegreesPerSecond), 1.f));
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRVelocityHistoryFallbackTest, "VRExpansionPlugin.VelocityHistory.Fallback", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRVelocityHistoryFallbackTest::RunTest(const FString & Parameters)
+{
+	UGripMotionControllerComponent * MotionController = NewObject<UGripMotionControllerComponent>(GetTransientPackage());
+	MotionController->ComponentVelocity = FVector(1.f, 2.f, 3.f);
+
+	FVector Velocity;
+
+	// Window smaller than a frame, falls back to the world space delta of the last two samples
+	MotionController->VelocityHistoryWindow = 0.f;
+	MotionController->VelocityHistory.AddSample(1.0, FVector(100.f, 0.f, 0.f), FQuat::Identity);
+	MotionController->VelocityHistory.AddSample(1.5, FVector(100.f, 50.f, 0.f), FQuat::Identity);
+
+	TestFalse(TEXT("No fit inside of an empty window"), MotionController->GetLinearVelocityFromHistory(Velocity));
+	TestTrue(TEXT("Falls back to the world space delta of the last two samples"), Velocity.Equals(FVector(0.f, 100.f, 0.f), KINDA_SMALL_NUMBER));
+
+	// Without history it falls back to ComponentVelocity, unattached relative space is world space
+	MotionController->ResetVelocityHistory();
+	TestFalse(TEXT("No fit without history"), MotionController->GetLinearVelocityFromHistory(Velocity));
+	TestEqual(TEXT("Falls back to ComponentVelocity without history"), Velocity, MotionController->ComponentVelocity);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
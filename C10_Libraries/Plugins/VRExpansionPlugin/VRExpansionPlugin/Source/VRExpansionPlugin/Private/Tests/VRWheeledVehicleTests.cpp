@@ -0,0 +1,221 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Misc/VRWheeledVehicle.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VRWheeledVehicleTestStatics
+{
+	// One step of the quantized signed ranges
+	static const float SignedStep = 2.0f / 511.0f;
+	static const float BrakeStep = 1.0f / 255.0f;
+
+	struct FVehicleInput
+	{
+		float Steering;
+		float Throttle;
+		float Brake;
+		bool bHandbrake;
+		int32 Gear;
+	};
+
+	// Kinematic bicycle model, stands in for the PhysX vehicle so the test doesn't need a world
+	struct FStubVehicle
+	{
+		FVector2D Location;
+		float Heading;
+		float Speed;
+
+		FStubVehicle() : Location(FVector2D::ZeroVector), Heading(0.f), Speed(0.f) {}
+
+		void Step(uint32 PackedInput, float DeltaTime)
+		{
+			FVehicleInput Input;
+			AVRWheeledVehicle::UnpackVehicleInput(PackedInput, Input.Steering, Input.Throttle, Input.Brake, Input.bHandbrake, Input.Gear);
+
+			const float WheelBase = 250.f;
+			const float MaxSteerAngle = FMath::DegreesToRadians(35.f);
+
+			Speed += Input.Throttle * 600.f * DeltaTime;
+			Speed -= FMath::Sign(Speed) * FMath::Min(FMath::Abs(Speed), (Input.Brake * 1200.f + (Input.bHandbrake ? 1800.f : 0.f)) * DeltaTime);
+			Speed = FMath::Clamp(Speed, -800.f, 2500.f);
+
+			Heading += Speed / WheelBase * FMath::Tan(Input.Steering * MaxSteerAngle) * DeltaTime;
+			Location += FVector2D(FMath::Cos(Heading), FMath::Sin(Heading)) * Speed * DeltaTime;
+		}
+	};
+
+	// Driver on a stick, smooth steering with throttle and brake taps
+	static uint32 GetDriverInput(float Time)
+	{
+		const float Steering = 0.8f * FMath::Sin(Time * 0.7f) * FMath::Clamp(FMath::Sin(Time * 0.23f) * 2.f, -1.f, 1.f);
+		const float Throttle = FMath::Fmod(Time, 6.f) < 4.f ? 1.f : 0.f;
+		const float Brake = FMath::Fmod(Time, 6.f) > 5.f ? 0.6f : 0.f;
+		return AVRWheeledVehicle::PackVehicleInput(Steering, Throttle, Brake, false, 1);
+	}
+
+	struct FInFlightInput
+	{
+		float ArrivalTime;
+		uint32 PackedInput;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRWheeledVehicleInputPackingTest, "VRExpansionPlugin.Vehicle.InputPacking", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRWheeledVehicleInputPackingTest::RunTest(const FString & Parameters)
+{
+	using namespace VRWheeledVehicleTestStatics;
+
+	FRandomStream Stream(46);
+
+	float MaxSteeringError = 0.f;
+	float MaxThrottleError = 0.f;
+	float MaxBrakeError = 0.f;
+	int32 NumMismatchedFlags = 0;
+
+	for (int32 i = 0; i < 10000; ++i)
+	{
+		const FVehicleInput In = { Stream.FRandRange(-1.f, 1.f), Stream.FRandRange(-1.f, 1.f), Stream.FRand(), Stream.FRand() > 0.5f, Stream.RandRange(-1, 30) };
+
+		FVehicleInput Out;
+		AVRWheeledVehicle::UnpackVehicleInput(AVRWheeledVehicle::PackVehicleInput(In.Steering, In.Throttle, In.Brake, In.bHandbrake, In.Gear), Out.Steering, Out.Throttle, Out.Brake, Out.bHandbrake, Out.Gear);
+
+		MaxSteeringError = FMath::Max(MaxSteeringError, FMath::Abs(Out.Steering - In.Steering));
+		MaxThrottleError = FMath::Max(MaxThrottleError, FMath::Abs(Out.Throttle - In.Throttle));
+		MaxBrakeError = FMath::Max(MaxBrakeError, FMath::Abs(Out.Brake - In.Brake));
+		NumMismatchedFlags += (Out.bHandbrake != In.bHandbrake || Out.Gear != In.Gear) ? 1 : 0;
+	}
+
+	// Within half a step, plus the zero snap for the signed values
+	TestTrue(TEXT("Steering survives packing within one step"), MaxSteeringError <= SignedStep);
+	TestTrue(TEXT("Throttle survives packing within one step"), MaxThrottleError <= SignedStep);
+	TestTrue(TEXT("Brake survives packing within half a step"), MaxBrakeError <= BrakeStep * 0.5f + KINDA_SMALL_NUMBER);
+	TestEqual(TEXT("Handbrake and gear survive packing exactly"), NumMismatchedFlags, 0);
+
+	AddInfo(FString::Printf(TEXT("Max error steering %.5f throttle %.5f brake %.5f"), MaxSteeringError, MaxThrottleError, MaxBrakeError));
+
+	// Edges and neutral
+	{
+		FVehicleInput Out;
+		AVRWheeledVehicle::UnpackVehicleInput(AVRWheeledVehicle::PackVehicleInput(0.f, 0.f, 0.f, false, 0), Out.Steering, Out.Throttle, Out.Brake, Out.bHandbrake, Out.Gear);
+		TestEqual(TEXT("Neutral steering is exactly zero"), Out.Steering, 0.f);
+		TestEqual(TEXT("Neutral throttle is exactly zero"), Out.Throttle, 0.f);
+		TestEqual(TEXT("Neutral brake is exactly zero"), Out.Brake, 0.f);
+		TestEqual(TEXT("Neutral gear"), Out.Gear, 0);
+
+		AVRWheeledVehicle::UnpackVehicleInput(AVRWheeledVehicle::PackVehicleInput(-1.f, 1.f, 1.f, true, -1), Out.Steering, Out.Throttle, Out.Brake, Out.bHandbrake, Out.Gear);
+		TestEqual(TEXT("Full left steering"), Out.Steering, -1.f);
+		TestEqual(TEXT("Full throttle"), Out.Throttle, 1.f);
+		TestEqual(TEXT("Full brake"), Out.Brake, 1.f);
+		TestEqual(TEXT("Reverse gear"), Out.Gear, -1);
+
+		// Out of range values clamp instead of bleeding into the neighbouring fields
+		AVRWheeledVehicle::UnpackVehicleInput(AVRWheeledVehicle::PackVehicleInput(5.f, -5.f, 2.f, false, 99), Out.Steering, Out.Throttle, Out.Brake, Out.bHandbrake, Out.Gear);
+		TestEqual(TEXT("Steering clamps"), Out.Steering, 1.f);
+		TestEqual(TEXT("Throttle clamps"), Out.Throttle, -1.f);
+		TestEqual(TEXT("Brake clamps"), Out.Brake, 1.f);
+		TestFalse(TEXT("Clamped values leave the handbrake alone"), Out.bHandbrake);
+		TestEqual(TEXT("Gear clamps"), Out.Gear, 30);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVRWheeledVehicleLatencyReplayTest, "VRExpansionPlugin.Vehicle.InputUplinkLatencyReplay", EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVRWheeledVehicleLatencyReplayTest::RunTest(const FString & Parameters)
+{
+	using namespace VRWheeledVehicleTestStatics;
+
+	const float DeltaTime = 1.f / 90.f;
+	const float DriveTime = 30.f;
+	const float SettleTime = 2.f;
+	const float ResendInterval = 0.1f;
+
+	// Engine path sends ServerUpdateState every tick with four floats and an int
+	const int64 EngineBitsPerRPC = 4 * 32 + 32;
+	const int64 PackedBitsPerRPC = 32;
+
+	for (int32 Case = 0; Case < 3; ++Case)
+	{
+		const float OneWayLatency = Case == 0 ? 0.03f : (Case == 1 ? 0.075f : 0.15f);
+		const float PacketLoss = Case == 0 ? 0.f : (Case == 1 ? 0.05f : 0.15f);
+
+		FRandomStream Stream(460 + Case);
+		FStubVehicle ClientVehicle;
+		FStubVehicle ServerVehicle;
+
+		TArray<FInFlightInput> InFlight;
+		uint32 ServerInput = AVRWheeledVehicle::PackVehicleInput(0.f, 0.f, 0.f, false, 1);
+		uint32 LastSentInput = ServerInput;
+		float LastSendTime = 0.f;
+
+		int32 NumSends = 0;
+		int32 NumTicks = 0;
+		float MaxDivergence = 0.f;
+		float MaxInputStaleness = 0.f;
+		TArray<uint32> ClientInputHistory;
+
+		for (float Time = 0.f; Time < DriveTime + SettleTime; Time += DeltaTime)
+		{
+			++NumTicks;
+
+			// Let go of everything for the last couple of seconds so both sides should end up on the same input
+			const uint32 ClientInput = Time < DriveTime ? GetDriverInput(Time) : AVRWheeledVehicle::PackVehicleInput(0.f, 0.f, 0.f, false, 1);
+
+			// Client predicts with its own input right away
+			ClientVehicle.Step(ClientInput, DeltaTime);
+			ClientInputHistory.Add(ClientInput);
+
+			if (AVRWheeledVehicle::ShouldSendPackedInput(ClientInput, LastSentInput, Time - LastSendTime, ResendInterval))
+			{
+				++NumSends;
+				LastSentInput = ClientInput;
+				LastSendTime = Time;
+
+				// Unreliable, lost sends are covered by the resend interval
+				if (Stream.FRand() >= PacketLoss)
+					InFlight.Add({ Time + OneWayLatency, ClientInput });
+			}
+
+			// Fixed latency so they arrive in the order they were sent
+			for (int32 i = 0; i < InFlight.Num(); ++i)
+			{
+				if (InFlight[i].ArrivalTime <= Time)
+				{
+					ServerInput = InFlight[i].PackedInput;
+					InFlight.RemoveAt(i--);
+				}
+			}
+
+			ServerVehicle.Step(ServerInput, DeltaTime);
+
+			// How far back the client last had the input the server is driving with
+			int32 TicksBehind = 0;
+			while (TicksBehind < ClientInputHistory.Num() - 1 && ClientInputHistory[ClientInputHistory.Num() - 1 - TicksBehind] != ServerInput)
+				++TicksBehind;
+			MaxInputStaleness = FMath::Max(MaxInputStaleness, TicksBehind * DeltaTime);
+
+			MaxDivergence = FMath::Max(MaxDivergence, (ClientVehicle.Location - ServerVehicle.Location).Size());
+		}
+
+		const FString Context = FString::Printf(TEXT("%.0fms one way, %.0f%% loss"), OneWayLatency * 1000.f, PacketLoss * 100.f);
+
+		TestEqual(*(Context + TEXT(": server ends on the clients input")), ServerInput, AVRWheeledVehicle::PackVehicleInput(0.f, 0.f, 0.f, false, 1));
+		TestTrue(*(Context + TEXT(": uplink sends less than the engine RPC every tick")), NumSends * PackedBitsPerRPC < NumTicks * EngineBitsPerRPC);
+
+		// A lost change is covered by the next change or resend, a run of losses at the resend interval is rare enough to allow a few
+		TestTrue(*(Context + TEXT(": server input never lags far behind the client")), MaxInputStaleness <= OneWayLatency + ResendInterval * 4.f + DeltaTime * 2.f);
+
+		const float TotalTime = DriveTime + SettleTime;
+		AddInfo(FString::Printf(TEXT("%s: max divergence %.1fcm, final %.1fcm, max input staleness %.0fms | uplink %d sends, %.0f bits/s packed vs %.0f bits/s ServerUpdateState"),
+			*Context, MaxDivergence, (ClientVehicle.Location - ServerVehicle.Location).Size(), MaxInputStaleness * 1000.f,
+			NumSends, (NumSends * PackedBitsPerRPC) / TotalTime, (NumTicks * EngineBitsPerRPC) / TotalTime));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
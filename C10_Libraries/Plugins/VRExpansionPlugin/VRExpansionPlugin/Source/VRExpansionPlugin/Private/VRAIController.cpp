@@ -5,6 +5,20 @@
 #include "Navigation/CrowdFollowingComponent.h"
 //#include "Runtime/Engine/Private/EnginePrivate.h"
 
+AVRAIController::AVRAIController(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	bUseLineOfSightCache = false;
+	LineOfSightCacheMaxAge = 0.1f;
+	LineOfSightCacheTolerance = 5.0f;
+	NumLineOfSightTraces = 0;
+	NumLineOfSightCacheHits = 0;
+}
+
+void AVRAIController::ClearLineOfSightCache()
+{
+	LineOfSightCache.Reset();
+}
 
 FVector AVRAIController::GetFocalPointOnActor(const AActor *Actor) const
 {
@@ -35,12 +49,59 @@ bool AVRAIController::LineOfSightTo(const AActor* Other, FVector ViewPoint, bool
 		}
 	}
 
+	if (!bUseLineOfSightCache)
+	{
+		return TraceLineOfSightTo(Other, ViewPoint, bAlternateChecks);
+	}
+
+	const AVRBaseCharacter * VRChar = Cast<const AVRBaseCharacter>(Other);
+	const FVector OtherActorLocation = VRChar != nullptr ? VRChar->GetVRLocation_Inline() : Other->GetActorLocation();
+	const float WorldTime = GetWorld()->GetTimeSeconds();
+	const float ToleranceSq = FMath::Square(LineOfSightCacheTolerance);
+
+	if (FVRLineOfSightCacheEntry * CachedEntry = LineOfSightCache.Find(Other))
+	{
+		if (CachedEntry->bAlternateChecks == bAlternateChecks &&
+			(WorldTime - CachedEntry->TimeStamp) <= LineOfSightCacheMaxAge &&
+			FVector::DistSquared(CachedEntry->ViewPoint, ViewPoint) <= ToleranceSq &&
+			FVector::DistSquared(CachedEntry->TargetLocation, OtherActorLocation) <= ToleranceSq)
+		{
+			CSV_CUSTOM_STAT(VRExpansion, LineOfSightCacheHits, 1, ECsvCustomStatOp::Accumulate);
+			++NumLineOfSightCacheHits;
+			return CachedEntry->bHasLineOfSight;
+		}
+	}
+	else
+	{
+		// New target, clean out anything that has gone stale so the map doesn't grow with dead actors
+		for (auto It = LineOfSightCache.CreateIterator(); It; ++It)
+		{
+			if (!It.Key().IsValid() || (WorldTime - It.Value().TimeStamp) > LineOfSightCacheMaxAge)
+				It.RemoveCurrent();
+		}
+	}
+
+	CSV_CUSTOM_STAT(VRExpansion, LineOfSightCacheMisses, 1, ECsvCustomStatOp::Accumulate);
+
+	FVRLineOfSightCacheEntry & NewEntry = LineOfSightCache.FindOrAdd(Other);
+	NewEntry.ViewPoint = ViewPoint;
+	NewEntry.TargetLocation = OtherActorLocation;
+	NewEntry.TimeStamp = WorldTime;
+	NewEntry.bAlternateChecks = bAlternateChecks;
+	NewEntry.bHasLineOfSight = TraceLineOfSightTo(Other, ViewPoint, bAlternateChecks);
+
+	return NewEntry.bHasLineOfSight;
+}
+
+bool AVRAIController::TraceLineOfSightTo(const AActor* Other, const FVector & ViewPoint, bool bAlternateChecks) const
+{
 	static FName NAME_LineOfSight = FName(TEXT("LineOfSight"));
 	FVector TargetLocation = Other->GetTargetLocation(GetPawn());
 
 	FCollisionQueryParams CollisionParams(NAME_LineOfSight, true, this->GetPawn());
 	CollisionParams.AddIgnoredActor(Other);
 
+	++NumLineOfSightTraces;
 	bool bHit = GetWorld()->LineTraceTestByChannel(ViewPoint, TargetLocation, ECC_Visibility, CollisionParams);
 	if (!bHit)
 	{
@@ -76,6 +137,7 @@ bool AVRAIController::LineOfSightTo(const AActor* Other, FVector ViewPoint, bool
 	if (!bAlternateChecks || !bLOSflag)
 	{
 		//try viewpoint to head
+		++NumLineOfSightTraces;
 		bHit = GetWorld()->LineTraceTestByChannel(ViewPoint, OtherActorLocation + FVector(0.f, 0.f, OtherHeight), ECC_Visibility, CollisionParams);
 		if (!bHit)
 		{
@@ -119,6 +181,7 @@ bool AVRAIController::LineOfSightTo(const AActor* Other, FVector ViewPoint, bool
 		{
 			if ((PointIndex != IndexMin) && (PointIndex != IndexMax))
 			{
+				++NumLineOfSightTraces;
 				bHit = GetWorld()->LineTraceTestByChannel(ViewPoint, Points[PointIndex], ECC_Visibility, CollisionParams);
 				if (!bHit)
 				{
@@ -1261,6 +1261,11 @@ void FSavedMove_VRBaseCharacter::Clear()
 	VRCapsuleRotation = FRotator::ZeroRotator;
 	LFDiff = FVector::ZeroVector;
 
+	SentLocation = FVector::ZeroVector;
+	SentBase.Reset();
+	SentBoneName = NAME_None;
+	bSavedLocationFromCombinedReplay = false;
+
 	ConditionalValues.CustomVRInputVector = FVector::ZeroVector;
 	ConditionalValues.RequestedVelocity = FVector::ZeroVector;
 	ConditionalValues.MoveActionArray.Clear();
@@ -411,6 +411,12 @@ void AVRCharacter::ClientVeryShortAdjustPositionVR_Implementation(float TimeStam
 	((UVRCharacterMovementComponent*)GetCharacterMovement())->ClientVeryShortAdjustPositionVR_Implementation(TimeStamp, NewLoc, NewYaw, NewBase, NewBaseBoneName, bHasBase, bBaseRelativePosition, ServerMovementMode);
 }
 
+// ClientCompactAdjustPosition
+void AVRCharacter::ClientCompactAdjustPositionVR_Implementation(float TimeStamp, FVRCompactClientAdjustment Adjustment)
+{
+	((UVRCharacterMovementComponent*)GetCharacterMovement())->ClientCompactAdjustPositionVR_Implementation(TimeStamp, Adjustment);
+}
+
 void AVRCharacter::RegenerateOffsetComponentToWorld(bool bUpdateBounds, bool bCalculatePureYaw)
 {
 	if (VRRootReference)
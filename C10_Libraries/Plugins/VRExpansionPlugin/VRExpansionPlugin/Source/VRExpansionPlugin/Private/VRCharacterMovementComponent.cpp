@@ -10,6 +10,8 @@
 #include "GameFramework/GameNetworkManager.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/GameState.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
 #include "Components/PrimitiveComponent.h"
 #include "Animation/AnimMontage.h"
 #include "DrawDebugHelpers.h"
@@ -22,6 +24,8 @@
 #include "AI/Navigation/AvoidanceManager.h"
 #include "Components/CapsuleComponent.h"
 #include "Components/BrushComponent.h"
+#include "PhysicsPublic.h"
+#include "Physics/PhysicsInterfaceCore.h"
 //#include "Components/DestructibleComponent.h"
 
 #include "Engine/DemoNetDriver.h"
@@ -39,6 +43,7 @@ DECLARE_CYCLE_STAT(TEXT("Char FindFloor"), STAT_CharFindFloor, STATGROUP_Charact
 DECLARE_CYCLE_STAT(TEXT("Char ReplicateMoveToServer"), STAT_CharacterMovementReplicateMoveToServer, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char CallServerMove"), STAT_CharacterMovementCallServerMove, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char CombineNetMove"), STAT_CharacterMovementCombineNetMove, STATGROUP_Character);
+DECLARE_CYCLE_STAT(TEXT("Char ClientUpdatePositionAfterServerUpdate"), STAT_CharacterMovementClientUpdatePositionAfterServerUpdate, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char PhysWalking"), STAT_CharPhysWalking, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char PhysFalling"), STAT_CharPhysFalling, STATGROUP_Character);
 DECLARE_CYCLE_STAT(TEXT("Char PhysNavWalking"), STAT_CharPhysNavWalking, STATGROUP_Character);
@@ -73,6 +78,89 @@ namespace CharacterMovementComponentStatics
 		TEXT("Rotation is replicated at 2 decimal precision, so values less than 0.01 won't matter."),
 		ECVF_Default);
 
+	static float fServerMoveBudgetMS = 0.0f;
+	FAutoConsoleVariableRef CVarServerMoveBudgetMS(
+		TEXT("vre.ServerMoveBudgetMS"),
+		fServerMoveBudgetMS,
+		TEXT("Milliseconds per frame each world spends running VR character moves as they arrive, 0 is unlimited.\n")
+		TEXT("Moves that arrive after it is used up are queued on their character and run (combined where possible) on its next tick.\n")
+		TEXT("A character queues at most VR_MAX_QUEUED_SERVER_MOVES moves, past that it catches up right away."),
+		ECVF_Default);
+
+	// Server move time used so far this frame, per world so a listen server and PIE instances don't eat each others budget
+	// The worlds are only keys and the map is emptied every frame, so nothing is held past the frame
+	static uint64 ServerMoveBudgetFrame = 0;
+	static TMap<const UWorld*, double, TInlineSetAllocator<4>> ServerMoveTimeThisFrame;
+
+	static void AddServerMoveTime(const UWorld* World, double Seconds)
+	{
+		if (ServerMoveBudgetFrame != GFrameCounter)
+		{
+			ServerMoveBudgetFrame = GFrameCounter;
+			ServerMoveTimeThisFrame.Reset();
+		}
+
+		ServerMoveTimeThisFrame.FindOrAdd(World) += Seconds;
+	}
+
+	static bool IsServerMoveBudgetSpent(const UWorld* World)
+	{
+		if (fServerMoveBudgetMS <= 0.0f || ServerMoveBudgetFrame != GFrameCounter)
+			return false;
+
+		const double* TimeThisFrame = ServerMoveTimeThisFrame.Find(World);
+		return TimeThisFrame && (*TimeThisFrame * 1000.0) >= fServerMoveBudgetMS;
+	}
+
+	// Lookups that every server move error check makes, refreshed once a frame
+	struct FServerMoveFrameCache
+	{
+		uint64 FrameNumber = MAX_uint64;
+		const AGameNetworkManager* GameNetworkManager = nullptr;
+		float ForceClientAdjustmentPercent = 0.0f;
+	};
+
+	static const FServerMoveFrameCache& GetServerMoveFrameCache()
+	{
+		static FServerMoveFrameCache FrameCache;
+		if (FrameCache.FrameNumber != GFrameCounter)
+		{
+			FrameCache.FrameNumber = GFrameCounter;
+			FrameCache.GameNetworkManager = GetDefault<AGameNetworkManager>();
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+			static const auto CVarNetForceClientAdjustmentPercent = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetForceClientAdjustmentPercent"));
+			FrameCache.ForceClientAdjustmentPercent = CVarNetForceClientAdjustmentPercent->GetFloat();
+#endif
+		}
+
+		return FrameCache;
+	}
+}
+
+bool FVRQueuedServerMove::CanCombineWith(const FVRQueuedServerMove& NewMove) const
+{
+	if (bIsOldMove || NewMove.bIsOldMove)
+		return false;
+
+	if (CompressedMoveFlags != NewMove.CompressedMoveFlags || ClientMovementMode != NewMove.ClientMovementMode || ClientMovementBase != NewMove.ClientMovementBase)
+		return false;
+
+	if (ConditionalReps.MoveActionArray.MoveActions.Num() > 0 || NewMove.ConditionalReps.MoveActionArray.MoveActions.Num() > 0)
+		return false;
+
+	if (!ConditionalReps.CustomVRInputVector.IsZero() || !NewMove.ConditionalReps.CustomVRInputVector.IsZero())
+		return false;
+
+	if (!ConditionalReps.RequestedVelocity.IsZero() || !NewMove.ConditionalReps.RequestedVelocity.IsZero())
+		return false;
+
+	// Capsule height is sent in the Z
+	if (!FMath::IsNearlyEqual(LFDiff.Z, NewMove.LFDiff.Z))
+		return false;
+
+	// Same input within 10%, the combined move runs the whole time on the newest input
+	return (InAccel - NewMove.InAccel).SizeSquared() <= FMath::Square(0.1f * FMath::Max(InAccel.Size(), NewMove.InAccel.Size()));
 }
 
 void UVRCharacterMovementComponent::Crouch(bool bClientSimulation)
@@ -579,6 +667,45 @@ void UVRCharacterMovementComponent::ServerMoveVROld_Implementation
 	uint8 OldMoveFlags,
 	FVRConditionalMoveRep ConditionalReps
 )
+{
+	// Nothing would ever drain the queue of an inactive component
+	if (!HasValidData() || !IsActive())
+	{
+		return;
+	}
+
+	if (QueuedServerMoves.Num() >= VR_MAX_QUEUED_SERVER_MOVES)
+	{
+		// Don't let a client grow the queue without bound, catch up now instead
+		ProcessQueuedServerMoves();
+	}
+	// Has to stay behind anything already queued or it would run out of order (and the budget would be skipped)
+	else if (QueuedServerMoves.Num() > 0 || CharacterMovementComponentStatics::IsServerMoveBudgetSpent(GetWorld()))
+	{
+		FVRQueuedServerMove QueuedMove;
+		QueuedMove.TimeStamp = OldTimeStamp;
+		QueuedMove.InAccel = OldAccel;
+		QueuedMove.CompressedMoveFlags = OldMoveFlags;
+		QueuedMove.ConditionalReps = ConditionalReps;
+		QueuedMove.bIsOldMove = true;
+
+		CSV_CUSTOM_STAT(VRExpansion, QueuedServerMoves, 1, ECsvCustomStatOp::Accumulate);
+		QueuedServerMoves.Add(QueuedMove);
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	ProcessServerMoveVROld(OldTimeStamp, OldAccel, OldMoveFlags, ConditionalReps);
+	CharacterMovementComponentStatics::AddServerMoveTime(GetWorld(), FPlatformTime::Seconds() - StartTime);
+}
+
+void UVRCharacterMovementComponent::ProcessServerMoveVROld
+(
+	float OldTimeStamp,
+	FVector_NetQuantize10 OldAccel,
+	uint8 OldMoveFlags,
+	FVRConditionalMoveRep ConditionalReps
+)
 {
 
 	if (!HasValidData() || !IsActive())
@@ -656,6 +783,106 @@ void UVRCharacterMovementComponent::ServerMoveVR_Implementation(
 	FVRConditionalMoveRep2 MoveReps,
 	uint8 ClientMovementMode)
 {
+	// Nothing would ever drain the queue of an inactive component
+	if (!HasValidData() || !IsActive())
+	{
+		return;
+	}
+
+	if (QueuedServerMoves.Num() >= VR_MAX_QUEUED_SERVER_MOVES)
+	{
+		// Don't let a client grow the queue without bound, catch up now instead
+		ProcessQueuedServerMoves();
+	}
+	// Once anything is queued the rest has to queue behind it to stay in order
+	else if (QueuedServerMoves.Num() > 0 || CharacterMovementComponentStatics::IsServerMoveBudgetSpent(GetWorld()))
+	{
+		FVRQueuedServerMove QueuedMove;
+		QueuedMove.TimeStamp = TimeStamp;
+		QueuedMove.InAccel = InAccel;
+		QueuedMove.ClientLoc = ClientLoc;
+		QueuedMove.CapsuleLoc = CapsuleLoc;
+		QueuedMove.ConditionalReps = ConditionalReps;
+		QueuedMove.LFDiff = LFDiff;
+		QueuedMove.CapsuleYaw = CapsuleYaw;
+		QueuedMove.CompressedMoveFlags = MoveFlags;
+		QueuedMove.MoveReps = MoveReps;
+		QueuedMove.ClientMovementBase = MoveReps.ClientMovementBase;
+		QueuedMove.ClientMovementMode = ClientMovementMode;
+
+		CSV_CUSTOM_STAT(VRExpansion, QueuedServerMoves, 1, ECsvCustomStatOp::Accumulate);
+
+		// The server move delta comes from the timestamps, so running only the newest one covers the time of both
+		if (QueuedServerMoves.Num() > 0 && QueuedServerMoves.Last().CanCombineWith(QueuedMove))
+		{
+			const FVector_NetQuantize100& OldLFDiff = QueuedServerMoves.Last().LFDiff;
+			QueuedMove.LFDiff = FVector(OldLFDiff.X + LFDiff.X, OldLFDiff.Y + LFDiff.Y, LFDiff.Z);
+			QueuedServerMoves.Last() = QueuedMove;
+
+			CSV_CUSTOM_STAT(VRExpansion, CombinedServerMoves, 1, ECsvCustomStatOp::Accumulate);
+		}
+		else
+		{
+			QueuedServerMoves.Add(QueuedMove);
+		}
+
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	ProcessServerMoveVR(TimeStamp, InAccel, ClientLoc, CapsuleLoc, ConditionalReps, LFDiff, CapsuleYaw, MoveFlags, MoveReps, ClientMovementMode);
+	CharacterMovementComponentStatics::AddServerMoveTime(GetWorld(), FPlatformTime::Seconds() - StartTime);
+}
+
+void UVRCharacterMovementComponent::Deactivate()
+{
+	// Queued moves are stale once the component stops, and would otherwise run whenever it comes back
+	QueuedServerMoves.Empty();
+	Super::Deactivate();
+}
+
+void UVRCharacterMovementComponent::OnUnregister()
+{
+	QueuedServerMoves.Empty();
+	Super::OnUnregister();
+}
+
+void UVRCharacterMovementComponent::ProcessQueuedServerMoves()
+{
+	CSV_SCOPED_TIMING_STAT(VRExpansion, ProcessQueuedServerMoves);
+
+	// These have already waited a frame, they run regardless of the budget so a starved character still moves every tick
+	TArray<FVRQueuedServerMove> MovesToProcess = MoveTemp(QueuedServerMoves);
+	QueuedServerMoves.Reset();
+
+	const double StartTime = FPlatformTime::Seconds();
+	for (FVRQueuedServerMove& QueuedMove : MovesToProcess)
+	{
+		if (QueuedMove.bIsOldMove)
+		{
+			ProcessServerMoveVROld(QueuedMove.TimeStamp, QueuedMove.InAccel, QueuedMove.CompressedMoveFlags, QueuedMove.ConditionalReps);
+			continue;
+		}
+
+		// The base may have been destroyed while waiting
+		QueuedMove.MoveReps.ClientMovementBase = QueuedMove.ClientMovementBase.Get();
+		ProcessServerMoveVR(QueuedMove.TimeStamp, QueuedMove.InAccel, QueuedMove.ClientLoc, QueuedMove.CapsuleLoc, QueuedMove.ConditionalReps, QueuedMove.LFDiff, QueuedMove.CapsuleYaw, QueuedMove.CompressedMoveFlags, QueuedMove.MoveReps, QueuedMove.ClientMovementMode);
+	}
+	CharacterMovementComponentStatics::AddServerMoveTime(GetWorld(), FPlatformTime::Seconds() - StartTime);
+}
+
+void UVRCharacterMovementComponent::ProcessServerMoveVR(
+	float TimeStamp,
+	FVector_NetQuantize10 InAccel,
+	FVector_NetQuantize100 ClientLoc,
+	FVector_NetQuantize100 CapsuleLoc,
+	FVRConditionalMoveRep ConditionalReps,
+	FVector_NetQuantize100 LFDiff,
+	uint16 CapsuleYaw,
+	uint8 MoveFlags,
+	FVRConditionalMoveRep2 MoveReps,
+	uint8 ClientMovementMode)
+{
 
 
 
@@ -821,6 +1048,10 @@ void UVRCharacterMovementComponent::CallServerMove
 	const FName ClientBaseBone = NewMove->EndBoneName;
 	const FVector SendLocation = MovementBaseUtility::UseRelativeLocation(ClientMovementBase) ? NewMove->SavedRelativeLocation : NewMove->SavedLocation;
 
+	NewMove->SentLocation = SendLocation;
+	NewMove->SentBase = ClientMovementBase;
+	NewMove->SentBoneName = ClientBaseBone;
+
 	// send old move if it exists
 	if (OldMove)
 	{
@@ -1558,6 +1789,25 @@ UVRCharacterMovementComponent::UVRCharacterMovementComponent(const FObjectInitia
 	bUseClientControlRotation = false;
 	bAllowMovementMerging = false;
 	bRequestedMoveUseAcceleration = false;
+	FloorCacheTolerance = 0.0f;
+	bUseCompactClientAdjustments = true;
+	PendingAdjustmentClientLoc = FVector::ZeroVector;
+	bPendingAdjustmentCanBeCompact = false;
+	bCombineReplayedMoves = false;
+	MaxCombinedReplayDeltaTime = 0.05f;
+	ReplaySkipTolerance = 0.0f;
+	bUseSimulatedProxyLOD = false;
+	SimulatedProxyLODDistance = 3000.0f;
+	SimulatedProxyLODHysteresis = 300.0f;
+	SimulatedProxyLODNotRenderedTime = 0.5f;
+	SimulatedProxyLODMinDwellTime = 1.0f;
+	bIsSimulatedProxyLowLOD = false;
+	SimulatedProxyLODChangeTime = TNumericLimits<float>::Lowest();
+	JitterCachedFloorLocation = FVector::ZeroVector;
+	JitterCachedFloorMovementMode = MOVE_None;
+	bHasJitterCachedFloor = false;
+	NumFloorTraces = 0;
+	NumFloorCacheHits = 0;
 }
 
 
@@ -1568,6 +1818,15 @@ void UVRCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTi
 		return;
 	}
 
+	CSV_SCOPED_TIMING_STAT(VRExpansion, VRCharacterMovementTick);
+	CSV_CUSTOM_STAT(VRExpansion, VRCharacterMovementCount, 1, ECsvCustomStatOp::Accumulate);
+
+	// Server moves held back by vre.ServerMoveBudgetMS last frame
+	if (QueuedServerMoves.Num() > 0)
+	{
+		ProcessQueuedServerMoves();
+	}
+
 	if (CharacterOwner && CharacterOwner->IsLocallyControlled())
 	{
 		// Root capsule is now throwing out the difference itself, I use the difference for multiplayer sends
@@ -1598,15 +1857,10 @@ void UVRCharacterMovementComponent::ApplyRepulsionForce(float DeltaSeconds)
 		const TArray<FOverlapInfo>& Overlaps = UpdatedPrimitive->GetOverlapInfos();
 		if (Overlaps.Num() > 0)
 		{
-			FCollisionQueryParams QueryParams;
-			QueryParams.bReturnFaceIndex = false;
-			QueryParams.bReturnPhysicalMaterial = false;
-
 			float CapsuleRadius = 0.f;
 			float CapsuleHalfHeight = 0.f;
 			CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleSize(CapsuleRadius, CapsuleHalfHeight);
 			const float RepulsionForceRadius = CapsuleRadius * 1.2f;
-			const float StopBodyDistance = 2.5f;
 			FVector MyLocation;
 			
 			if (VRRootCapsule)
@@ -1614,6 +1868,16 @@ void UVRCharacterMovementComponent::ApplyRepulsionForce(float DeltaSeconds)
 			else
 				MyLocation = UpdatedPrimitive->GetComponentLocation();
 
+			// Gathered first and then applied under a single scene lock
+			struct FRepulsionEntry
+			{
+				FBodyInstance* Body;
+				FVector ForceCenter;
+				bool bStopBody;
+			};
+
+			TArray<FRepulsionEntry, TInlineAllocator<16>> RepulsionEntries;
+
 			for (int32 i = 0; i < Overlaps.Num(); i++)
 			{
 				const FOverlapInfo& Overlap = Overlaps[i];
@@ -1653,49 +1917,109 @@ void UVRCharacterMovementComponent::ApplyRepulsionForce(float DeltaSeconds)
 				FVector BodyVelocity = OverlapBody->GetUnrealWorldVelocity();
 				FVector BodyLocation = BodyTransform.GetLocation();
 
-				// Trace to get the hit location on the capsule
-				FHitResult Hit;
-				bool bHasHit = UpdatedPrimitive->LineTraceComponent(Hit, BodyLocation,
-					FVector(MyLocation.X, MyLocation.Y, BodyLocation.Z),
-					QueryParams);
-
-				FVector HitLoc = Hit.ImpactPoint;
-				bool bIsPenetrating = Hit.bStartPenetrating || Hit.PenetrationDepth > StopBodyDistance;
-
-				// If we didn't hit the capsule, we're inside the capsule
-				if (!bHasHit)
+				FVector ForceCenter;
+				bool bStopBody = false;
+				if (GetRepulsionForceCenter(MyLocation, CapsuleRadius, CapsuleHalfHeight, BodyLocation, BodyVelocity, DeltaSeconds, ForceCenter, bStopBody))
 				{
-					HitLoc = BodyLocation;
-					bIsPenetrating = true;
+					RepulsionEntries.Add({ OverlapBody, ForceCenter, bStopBody });
 				}
+			}
 
-				const float DistanceNow = (HitLoc - BodyLocation).SizeSquared2D();
-				const float DistanceLater = (HitLoc - (BodyLocation + BodyVelocity * DeltaSeconds)).SizeSquared2D();
-
-				if (bHasHit && DistanceNow < StopBodyDistance && !bIsPenetrating)
-				{
-					OverlapBody->SetLinearVelocity(FVector(0.0f, 0.0f, 0.0f), false);
-				}
-				else if (DistanceLater <= DistanceNow || bIsPenetrating)
+			if (RepulsionEntries.Num() > 0)
+			{
+				auto ApplyRepulsionEntries = [&]()
 				{
-					FVector ForceCenter = MyLocation;
-
-					if (bHasHit)
-					{
-						ForceCenter.Z = HitLoc.Z;
-					}
-					else
+					for (const FRepulsionEntry & Entry : RepulsionEntries)
 					{
-						ForceCenter.Z = FMath::Clamp(BodyLocation.Z, MyLocation.Z - CapsuleHalfHeight, MyLocation.Z + CapsuleHalfHeight);
+						if (Entry.bStopBody)
+							Entry.Body->SetLinearVelocity(FVector(0.0f, 0.0f, 0.0f), false);
+						else
+							Entry.Body->AddRadialForceToBody(Entry.ForceCenter, RepulsionForceRadius, RepulsionForce * Mass, ERadialImpulseFalloff::RIF_Constant);
 					}
+				};
 
-					OverlapBody->AddRadialForceToBody(ForceCenter, RepulsionForceRadius, RepulsionForce * Mass, ERadialImpulseFalloff::RIF_Constant);
+				// The per body calls re-enter the lock that we already hold instead of taking it each time
+				FPhysScene* PhysScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr;
+				if (!PhysScene || !FPhysicsCommand::ExecuteWrite(PhysScene, ApplyRepulsionEntries))
+				{
+					ApplyRepulsionEntries();
 				}
 			}
 		}
 	}
 }
 
+bool UVRCharacterMovementComponent::GetRepulsionForceCenter(const FVector& CapsuleLocation, float CapsuleRadius, float CapsuleHalfHeight, const FVector& BodyLocation, const FVector& BodyVelocity, float DeltaSeconds, FVector& OutForceCenter, bool& bOutStopBody)
+{
+	const float StopBodyDistance = 2.5f;
+	const float CapsuleCylinderHalfHeight = FMath::Max(CapsuleHalfHeight - CapsuleRadius, 0.0f);
+
+	// Get the hit location on the capsule, this is a horizontal ray from the body towards the capsules axis
+	// so it is solved against the capsules cross section at the bodies height instead of tracing the component.
+	bool bHasHit = false;
+	bool bIsPenetrating = false;
+	FVector HitLoc = BodyLocation;
+
+	const float HeightFromCenter = FMath::Abs(BodyLocation.Z - CapsuleLocation.Z);
+	if (HeightFromCenter <= CapsuleHalfHeight)
+	{
+		float SectionRadius = CapsuleRadius;
+		if (HeightFromCenter > CapsuleCylinderHalfHeight)
+		{
+			const float CapHeight = HeightFromCenter - CapsuleCylinderHalfHeight;
+			SectionRadius = FMath::Sqrt(FMath::Max(FMath::Square(CapsuleRadius) - FMath::Square(CapHeight), 0.0f));
+		}
+
+		const FVector ToBody = FVector(BodyLocation.X - CapsuleLocation.X, BodyLocation.Y - CapsuleLocation.Y, 0.0f);
+		const float DistToAxis = ToBody.Size();
+
+		bHasHit = true;
+		if (DistToAxis <= SectionRadius)
+		{
+			// Started inside of the capsule
+			bIsPenetrating = true;
+		}
+		else
+		{
+			HitLoc = FVector(CapsuleLocation.X, CapsuleLocation.Y, BodyLocation.Z) + (ToBody * (SectionRadius / DistToAxis));
+		}
+	}
+
+	// If we didn't hit the capsule, we're inside the capsule
+	if (!bHasHit)
+	{
+		HitLoc = BodyLocation;
+		bIsPenetrating = true;
+	}
+
+	const float DistanceNow = (HitLoc - BodyLocation).SizeSquared2D();
+	const float DistanceLater = (HitLoc - (BodyLocation + BodyVelocity * DeltaSeconds)).SizeSquared2D();
+
+	bOutStopBody = false;
+	OutForceCenter = CapsuleLocation;
+
+	if (bHasHit && DistanceNow < StopBodyDistance && !bIsPenetrating)
+	{
+		bOutStopBody = true;
+		return true;
+	}
+	else if (DistanceLater <= DistanceNow || bIsPenetrating)
+	{
+		if (bHasHit)
+		{
+			OutForceCenter.Z = HitLoc.Z;
+		}
+		else
+		{
+			OutForceCenter.Z = FMath::Clamp(BodyLocation.Z, CapsuleLocation.Z - CapsuleHalfHeight, CapsuleLocation.Z + CapsuleHalfHeight);
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
 
 void UVRCharacterMovementComponent::SetUpdatedComponent(USceneComponent* NewUpdatedComponent)
 {
@@ -2456,6 +2780,46 @@ FVector UVRCharacterMovementComponent::GetImpartedMovementBaseVelocity() const
 
 
 
+bool UVRCharacterMovementComponent::GetJitterCachedFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult) const
+{
+	if (!bHasJitterCachedFloor || FloorCacheTolerance <= 0.0f || MovementMode != JitterCachedFloorMovementMode)
+		return false;
+
+	// Must still be on the same base and it can't be able to move out from under us
+	UPrimitiveComponent* MovementBase = CharacterOwner->GetMovementBase();
+	if (!MovementBase || MovementBase != JitterCachedFloorBase.Get() || MovementBaseUtility::IsDynamicBase(MovementBase) || MovementBase->IsPendingKill())
+		return false;
+
+	// The cached FloorDist / LineDist are heights above the floor, any vertical drift would make them stale
+	const FVector Diff = CapsuleLocation - JitterCachedFloorLocation;
+	if (Diff.SizeSquared2D() > FMath::Square(FloorCacheTolerance) || !FMath::IsNearlyZero(Diff.Z, KINDA_SMALL_NUMBER))
+		return false;
+
+	// Walkable settings could have been changed since it was stored
+	if (!JitterCachedFloor.IsWalkableFloor() || !IsWalkable(JitterCachedFloor.HitResult))
+		return false;
+
+	OutFloorResult = JitterCachedFloor;
+	return true;
+}
+
+void UVRCharacterMovementComponent::StoreJitterCachedFloor(const FVector& CapsuleLocation, const FFindFloorResult& FloorResult) const
+{
+	bHasJitterCachedFloor = FloorCacheTolerance > 0.0f && FloorResult.IsWalkableFloor() && FloorResult.HitResult.Component.IsValid();
+
+	if (bHasJitterCachedFloor)
+	{
+		JitterCachedFloor = FloorResult;
+		JitterCachedFloorLocation = CapsuleLocation;
+		JitterCachedFloorBase = FloorResult.HitResult.Component;
+		JitterCachedFloorMovementMode = MovementMode;
+	}
+	else
+	{
+		JitterCachedFloorBase.Reset();
+	}
+}
+
 void UVRCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult, bool bCanUseCachedLocation, const FHitResult* DownwardSweepResult) const
 {
 	SCOPE_CYCLE_COUNTER(STAT_CharFindFloor);
@@ -2491,8 +2855,22 @@ void UVRCharacterMovementComponent::FindFloor(const FVector& CapsuleLocation, FF
 
 		if (bAlwaysCheckFloor || !bCanUseCachedLocation || bForceNextFloorCheck || bJustTeleported)
 		{
+			// Only the cached location request is skipped here, anything that forced a check still traces
+			const bool bCanUseJitterCache = !bAlwaysCheckFloor && !bForceNextFloorCheck && !bJustTeleported && DownwardSweepResult == NULL;
 			MutableThis->bForceNextFloorCheck = false;
-			ComputeFloorDist(UseCapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
+
+			if (bCanUseJitterCache && GetJitterCachedFloor(UseCapsuleLocation, OutFloorResult))
+			{
+				CSV_CUSTOM_STAT(VRExpansion, FloorCacheHits, 1, ECsvCustomStatOp::Accumulate);
+				++NumFloorCacheHits;
+			}
+			else
+			{
+				CSV_CUSTOM_STAT(VRExpansion, FloorTraces, 1, ECsvCustomStatOp::Accumulate);
+				++NumFloorTraces;
+				ComputeFloorDist(UseCapsuleLocation, FloorLineTraceDist, FloorSweepTraceDist, OutFloorResult, CharacterOwner->GetCapsuleComponent()->GetScaledCapsuleRadius(), DownwardSweepResult);
+				StoreJitterCachedFloor(UseCapsuleLocation, OutFloorResult);
+			}
 		}
 		else
 		{
@@ -3676,6 +4054,8 @@ void UVRCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 		return;
 	}
 
+	CSV_SCOPED_TIMING_STAT(VRExpansion, VRCharacterSimulateMovement);
+
 	const bool bIsSimulatedProxy = (CharacterOwner->Role == ROLE_SimulatedProxy);
 
 	// Workaround for replication not being updated initially
@@ -3694,6 +4074,18 @@ void UVRCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 		return;
 	}
 
+	bool bLowLOD = false;
+	if (bIsSimulatedProxy)
+	{
+		if (UpdateSimulatedProxyLOD() && !bIsSimulatedProxyLowLOD)
+		{
+			// The floor wasn't kept up to date while in the low LOD
+			bForceNextFloorCheck = true;
+		}
+
+		bLowLOD = bIsSimulatedProxyLowLOD;
+	}
+
 	FVector OldVelocity;
 	FVector OldLocation;
 
@@ -3715,14 +4107,14 @@ void UVRCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 					ApplyNetworkMovementMode(CharacterOwner->GetReplicatedMovementMode());
 					bNetworkMovementModeChanged = false;
 				}
-				else if (bJustTeleported || bForceNextFloorCheck)
+				else if (!bLowLOD && (bJustTeleported || bForceNextFloorCheck))
 				{
 					// Make sure floor is current. We will continue using the replicated base, if there was one.
 					bJustTeleported = false;
 					UpdateFloorFromAdjustment();
 				}
 			}
-			else if (bForceNextFloorCheck)
+			else if (!bLowLOD && bForceNextFloorCheck)
 			{
 				UpdateFloorFromAdjustment();
 			}
@@ -3760,7 +4152,12 @@ void UVRCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 
 		static const auto CVarNetEnableSkipProxyPredictionOnNetUpdate = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetEnableSkipProxyPredictionOnNetUpdate"));
 		// May only need to simulate forward on frames where we haven't just received a new position update.
-		if (!bHandledNetUpdate || !bNetworkSkipProxyPredictionOnNetUpdate || !CVarNetEnableSkipProxyPredictionOnNetUpdate->GetInt())
+		if (bLowLOD)
+		{
+			// Low LOD proxies hold the replicated location, the network smoothing covers the mesh between updates
+			CSV_CUSTOM_STAT(VRExpansion, ProxyLowLODSims, 1, ECsvCustomStatOp::Accumulate);
+		}
+		else if (!bHandledNetUpdate || !bNetworkSkipProxyPredictionOnNetUpdate || !CVarNetEnableSkipProxyPredictionOnNetUpdate->GetInt())
 		{
 			UE_LOG(LogVRCharacterMovement, Verbose, TEXT("Proxy %s simulating movement"), *GetNameSafe(CharacterOwner));
 			FStepDownResult StepDownResult;
@@ -3845,6 +4242,58 @@ void UVRCharacterMovementComponent::SimulateMovement(float DeltaSeconds)
 	LastUpdateVelocity = Velocity;
 }
 
+bool UVRCharacterMovementComponent::UpdateSimulatedProxyLOD()
+{
+	bool bWantsLowLOD = false;
+
+	if (bUseSimulatedProxyLOD)
+	{
+		if (SimulatedProxyLODNotRenderedTime > 0.0f && !CharacterOwner->WasRecentlyRendered(SimulatedProxyLODNotRenderedTime))
+		{
+			bWantsLowLOD = true;
+		}
+		else
+		{
+			// Split screen can have more than one view, the closest one decides
+			const FVector ProxyLocation = UpdatedComponent->GetComponentLocation();
+			float ClosestDistSq = 0.0f;
+			bool bFoundView = false;
+
+			for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+			{
+				const APlayerController* PC = Iterator->Get();
+				if (PC && PC->IsLocalPlayerController() && PC->PlayerCameraManager)
+				{
+					const float DistSq = FVector::DistSquared(PC->PlayerCameraManager->GetCameraLocation(), ProxyLocation);
+					ClosestDistSq = bFoundView ? FMath::Min(ClosestDistSq, DistSq) : DistSq;
+					bFoundView = true;
+				}
+			}
+
+			// Already in the low LOD has to come back inside the hysteresis band before returning to full simulation
+			if (bFoundView)
+			{
+				const float LODDistance = bIsSimulatedProxyLowLOD ? FMath::Max(0.0f, SimulatedProxyLODDistance - SimulatedProxyLODHysteresis) : SimulatedProxyLODDistance;
+				bWantsLowLOD = ClosestDistSq > FMath::Square(LODDistance);
+			}
+		}
+	}
+
+	if (bWantsLowLOD != bIsSimulatedProxyLowLOD)
+	{
+		// Turning the LOD off always applies right away
+		const float CurrentTime = GetWorld()->GetTimeSeconds();
+		if (bUseSimulatedProxyLOD && CurrentTime - SimulatedProxyLODChangeTime < SimulatedProxyLODMinDwellTime)
+			return false;
+
+		bIsSimulatedProxyLowLOD = bWantsLowLOD;
+		SimulatedProxyLODChangeTime = CurrentTime;
+		return true;
+	}
+
+	return false;
+}
+
 void UVRCharacterMovementComponent::MoveSmooth(const FVector& InVelocity, const float DeltaSeconds, FStepDownResult* OutStepDownResult)
 {
 	if (!HasValidData())
@@ -3986,6 +4435,16 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 					PackNetworkMovementMode()
 				);
 			}
+			else if (bUseCompactClientAdjustments && bPendingAdjustmentCanBeCompact)
+			{
+				FVRCompactClientAdjustment CompactAdjustment;
+				CompactAdjustment.LocationOffset = ServerData->PendingAdjustment.NewLoc - PendingAdjustmentClientLoc;
+				CompactAdjustment.NewVelocity = ServerData->PendingAdjustment.NewVel;
+				CompactAdjustment.NewYaw = FRotator::CompressAxisToShort(ServerData->PendingAdjustment.NewRot.Yaw);
+				CompactAdjustment.ServerMovementMode = PackNetworkMovementMode();
+
+				ClientCompactAdjustPositionVR(ServerData->PendingAdjustment.TimeStamp, CompactAdjustment);
+			}
 			else if (ServerData->PendingAdjustment.NewVel.IsZero())
 			{
 				ClientVeryShortAdjustPositionVR
@@ -4021,6 +4480,10 @@ void UVRCharacterMovementComponent::SendClientAdjustment()
 	ServerData->PendingAdjustment.TimeStamp = 0;
 	ServerData->PendingAdjustment.bAckGoodMove = false;
 	ServerData->bForceClientUpdate = false;
+
+	// Only valid for the adjustment that was just consumed, a later one set outside of ServerMoveHandleClientErrorVR would otherwise reuse it
+	PendingAdjustmentClientLoc = FVector::ZeroVector;
+	bPendingAdjustmentCanBeCompact = false;
 }
 
 
@@ -4048,6 +4511,41 @@ void UVRCharacterMovementComponent::ClientVeryShortAdjustPositionVR_Implementati
 }
 
 
+void UVRCharacterMovementComponent::ClientCompactAdjustPositionVR(float TimeStamp, const FVRCompactClientAdjustment& Adjustment)
+{
+	((AVRCharacter*)CharacterOwner)->ClientCompactAdjustPositionVR(TimeStamp, Adjustment);
+}
+
+void UVRCharacterMovementComponent::ClientCompactAdjustPositionVR_Implementation(float TimeStamp, const FVRCompactClientAdjustment& Adjustment)
+{
+	if (!HasValidData() || !IsActive())
+	{
+		return;
+	}
+
+	FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+	check(ClientData);
+
+	int32 MoveIndex = ClientData->GetSavedMoveIndex(TimeStamp);
+	if (MoveIndex == INDEX_NONE)
+	{
+		if (ClientData->LastAckedMove.IsValid())
+		{
+			UE_LOG(LogNetPlayerMovement, Log, TEXT("ClientCompactAdjustPositionVR_Implementation could not find Move for TimeStamp: %f, LastAckedTimeStamp: %f, CurrentTimeStamp: %f"), TimeStamp, ClientData->LastAckedMove->TimeStamp, ClientData->CurrentTimeStamp);
+		}
+		return;
+	}
+
+	// Rebuild the location that we sent for this move, quantized the same way that the server received it
+	const FSavedMove_VRBaseCharacter* CorrectedMove = (const FSavedMove_VRBaseCharacter*)ClientData->SavedMoves[MoveIndex].Get();
+	UPrimitiveComponent* MoveBase = CorrectedMove->SentBase.Get();
+	const bool bBaseRelativePosition = MovementBaseUtility::UseRelativeLocation(MoveBase);
+	const FVector& SentLocation = CorrectedMove->SentLocation;
+	const FVector QuantizedSentLocation(FMath::RoundToInt(SentLocation.X * 100.f) / 100.f, FMath::RoundToInt(SentLocation.Y * 100.f) / 100.f, FMath::RoundToInt(SentLocation.Z * 100.f) / 100.f);
+
+	ClientAdjustPositionVR_Implementation(TimeStamp, QuantizedSentLocation + Adjustment.LocationOffset, Adjustment.NewYaw, Adjustment.NewVelocity, MoveBase, CorrectedMove->SentBoneName, MoveBase != nullptr, bBaseRelativePosition, Adjustment.ServerMovementMode);
+}
+
 void UVRCharacterMovementComponent::ClientAdjustPositionVR(float TimeStamp, FVector NewLoc, uint16 NewYaw, FVector NewVel, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode)
 {
 	((AVRCharacter*)CharacterOwner)->ClientAdjustPositionVR(TimeStamp, NewLoc, NewYaw, NewVel, NewBase, NewBaseBoneName, bHasBase, bBaseRelativePosition, ServerMovementMode);
@@ -4144,6 +4642,37 @@ void UVRCharacterMovementComponent::ClientAdjustPositionVR_Implementation
 	// Trigger event
 	OnClientCorrectionReceived(*ClientData, TimeStamp, WorldShiftedNewLocation, NewVelocity, NewBase, NewBaseBoneName, bHasBase, bBaseRelativePosition, ServerMovementMode);
 
+	// Small corrections get shifted onto the current prediction instead of rewinding and replaying every pending move
+	FVector LocationOffset;
+	FVector VelocityOffset;
+	if (!bUnresolvedBase && !bBaseRelativePosition && GetCorrectionOffsetWithoutReplay(*ClientData, WorldShiftedNewLocation, NewVelocity, NewBase, ServerMovementMode, LocationOffset, VelocityOffset))
+	{
+		CSV_CUSTOM_STAT(VRExpansion, SkippedReplays, 1, ECsvCustomStatOp::Accumulate);
+
+		UpdatedComponent->SetWorldLocation(UpdatedComponent->GetComponentLocation() + LocationOffset, false);
+		Velocity += VelocityOffset;
+
+		for (FSavedMovePtr& SavedMove : ClientData->SavedMoves)
+		{
+			SavedMove->SavedLocation += LocationOffset;
+		}
+
+		// Its start location is from before the offset, don't let it revert there on a combine
+		if (FSavedMove_Character* const PendingMove = ClientData->PendingMove.Get())
+		{
+			PendingMove->bForceNoCombine = true;
+		}
+
+		bJustTeleported = true;
+		SaveBaseLocation();
+
+		LastUpdateLocation = UpdatedComponent->GetComponentLocation();
+		LastUpdateVelocity = Velocity;
+
+		UpdateComponentVelocity();
+		return;
+	}
+
 	// Trust the server's positioning.
 	UpdatedComponent->SetWorldLocation(WorldShiftedNewLocation, false);
 	Velocity = NewVelocity;
@@ -4194,6 +4723,185 @@ void UVRCharacterMovementComponent::ClientAdjustPositionVR_Implementation
 	ClientData->bUpdatePosition = true;
 }
 
+bool UVRCharacterMovementComponent::GetCorrectionOffsetWithoutReplay(const FNetworkPredictionData_Client_Character& ClientData, const FVector& NewLocation, const FVector& NewVelocity, UPrimitiveComponent* NewBase, uint8 ServerMovementMode, FVector& OutLocationOffset, FVector& OutVelocityOffset) const
+{
+	if (ReplaySkipTolerance <= 0.0f || !ClientData.LastAckedMove.IsValid() || MovementBaseUtility::UseRelativeLocation(NewBase))
+		return false;
+
+	// Root motion has to be resimulated from the servers state
+	if (CharacterOwner->bClientResimulateRootMotion || CharacterOwner->bClientResimulateRootMotionSources || CurrentRootMotion.HasActiveRootMotionSources())
+		return false;
+
+	// Only the position and speed are allowed to have drifted, the state has to match what we predicted
+	const FSavedMove_Character* AckedMove = ClientData.LastAckedMove.Get();
+
+	// Its saved location isn't where it actually ended, comparing against it would skip real errors
+	if (((const FSavedMove_VRBaseCharacter*)AckedMove)->bSavedLocationFromCombinedReplay)
+		return false;
+
+	if (AckedMove->EndPackedMovementMode != ServerMovementMode || AckedMove->EndBase.Get() != NewBase)
+		return false;
+
+	if (PackNetworkMovementMode() != ServerMovementMode || CharacterOwner->GetMovementBase() != NewBase)
+		return false;
+
+	float PendingTime = 0.0f;
+	for (const FSavedMovePtr& SavedMove : ClientData.SavedMoves)
+	{
+		const FSavedMove_VRBaseCharacter* VRMove = (const FSavedMove_VRBaseCharacter*)SavedMove.Get();
+
+		// Anything that isn't plain movement needs the real replay
+		if (VRMove->VRReplicatedMovementMode != EVRConjoinedMovementModes::C_MOVE_MAX || VRMove->ConditionalValues.MoveActionArray.MoveActions.Num() > 0 ||
+			!VRMove->ConditionalValues.CustomVRInputVector.IsZero() || !VRMove->ConditionalValues.RequestedVelocity.IsZero())
+			return false;
+
+		PendingTime += VRMove->DeltaTime;
+	}
+
+	// The first pending move started with the velocity we predicted at the end of the acked one
+	const FVector PredictedVelocity = ClientData.SavedMoves.Num() > 0 ? ClientData.SavedMoves[0]->Velocity : Velocity;
+
+	OutLocationOffset = NewLocation - AckedMove->SavedLocation;
+	OutVelocityOffset = NewVelocity - PredictedVelocity;
+
+	// Worst case divergence by the end of the pending moves
+	return OutLocationOffset.Size() + (OutVelocityOffset.Size() * PendingTime) <= ReplaySkipTolerance;
+}
+
+bool UVRCharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
+{
+	SCOPE_CYCLE_COUNTER(STAT_CharacterMovementClientUpdatePositionAfterServerUpdate);
+	if (!HasValidData())
+	{
+		return false;
+	}
+
+	FNetworkPredictionData_Client_Character* ClientData = GetPredictionData_Client_Character();
+	check(ClientData);
+
+	if (!ClientData->bUpdatePosition)
+	{
+		return false;
+	}
+
+	// Without combining this is the same as the engines replay
+	if (!bCombineReplayedMoves)
+	{
+		CSV_SCOPED_TIMING_STAT(VRExpansion, ClientReplay);
+		CSV_CUSTOM_STAT(VRExpansion, ReplayedMoves, ClientData->SavedMoves.Num(), ECsvCustomStatOp::Accumulate);
+		return Super::ClientUpdatePositionAfterServerUpdate();
+	}
+
+	ClientData->bUpdatePosition = false;
+
+	// Don't do any network position updates on things running PHYS_RigidBody
+	if (CharacterOwner->GetRootComponent() && CharacterOwner->GetRootComponent()->IsSimulatingPhysics())
+	{
+		return false;
+	}
+
+	if (ClientData->SavedMoves.Num() == 0)
+	{
+		// With no saved moves to resimulate, the move the server updated us with is the last move we've done, no resimulation needed.
+		CharacterOwner->bClientResimulateRootMotion = false;
+		if (CharacterOwner->bClientResimulateRootMotionSources)
+		{
+			// With no resimulation, we just update our current root motion to what the server sent us
+			CurrentRootMotion.UpdateStateFrom(CharacterOwner->SavedRootMotion);
+			CharacterOwner->bClientResimulateRootMotionSources = false;
+		}
+
+		return false;
+	}
+
+	CSV_SCOPED_TIMING_STAT(VRExpansion, ClientReplay);
+	CSV_CUSTOM_STAT(VRExpansion, ReplayedMoves, ClientData->SavedMoves.Num(), ECsvCustomStatOp::Accumulate);
+
+	// Save important values that might get affected by the replay.
+	const float SavedAnalogInputModifier = AnalogInputModifier;
+	const FRootMotionMovementParams BackupRootMotionParams = RootMotionParams; // For animation root motion
+	const FRootMotionSourceGroup BackupRootMotion = CurrentRootMotion;
+	const bool bRealJump = CharacterOwner->bPressedJump;
+	const bool bRealCrouch = bWantsToCrouch;
+	const bool bRealForceMaxAccel = bForceMaxAccel;
+	CharacterOwner->bClientWasFalling = (MovementMode == MOVE_Falling);
+	CharacterOwner->bClientUpdating = true;
+	bForceNextFloorCheck = true;
+
+	const float MaxCombinedDelta = FMath::Min(MaxCombinedReplayDeltaTime, ClientData->MaxMoveDeltaTime) * CharacterOwner->GetActorTimeDilation();
+
+	// Replay moves that have not yet been acked.
+	UE_LOG(LogNetPlayerMovement, Verbose, TEXT("ClientUpdatePositionAfterServerUpdate Replaying %d Moves, starting at Timestamp %f"), ClientData->SavedMoves.Num(), ClientData->SavedMoves[0]->TimeStamp);
+	int32 MoveIndex = 0;
+	while (MoveIndex < ClientData->SavedMoves.Num())
+	{
+		// Find the run of moves that the normal move merging would have allowed to be sent as one
+		int32 LastIndex = MoveIndex;
+		float CombinedDelta = ClientData->SavedMoves[MoveIndex]->DeltaTime;
+		FVector CombinedLFDiff = ((FSavedMove_VRBaseCharacter*)ClientData->SavedMoves[MoveIndex].Get())->LFDiff;
+		while (LastIndex + 1 < ClientData->SavedMoves.Num())
+		{
+			const FSavedMovePtr& NextMove = ClientData->SavedMoves[LastIndex + 1];
+			if (CombinedDelta + NextMove->DeltaTime > MaxCombinedDelta || !ClientData->SavedMoves[LastIndex]->CanCombineWith(NextMove, CharacterOwner, MaxCombinedDelta))
+				break;
+
+			CombinedDelta += NextMove->DeltaTime;
+			CombinedLFDiff += ((FSavedMove_VRBaseCharacter*)NextMove.Get())->LFDiff;
+			++LastIndex;
+		}
+
+		// The last move holds the end capsule location and inputs, the HMD movement of the whole run is applied in the one step
+		FSavedMove_Character* const LastMove = ClientData->SavedMoves[LastIndex].Get();
+		LastMove->PrepMoveFor(CharacterOwner);
+
+		if (LastIndex != MoveIndex && VRRootCapsule)
+		{
+			VRRootCapsule->DifferenceFromLastFrame = FVector(CombinedLFDiff.X, CombinedLFDiff.Y, 0.0f);
+			AdditionalVRInputVector = VRRootCapsule->DifferenceFromLastFrame;
+		}
+
+		MoveAutonomous(LastMove->TimeStamp, CombinedDelta, LastMove->GetCompressedFlags(), LastMove->Acceleration);
+		CSV_CUSTOM_STAT(VRExpansion, ReplaySteps, 1, ECsvCustomStatOp::Accumulate);
+
+		for (int32 i = MoveIndex; i <= LastIndex; ++i)
+		{
+			ClientData->SavedMoves[i]->PostUpdate(CharacterOwner, FSavedMove_Character::PostUpdate_Replay);
+
+			// Only the last move of the run actually ended here
+			((FSavedMove_VRBaseCharacter*)ClientData->SavedMoves[i].Get())->bSavedLocationFromCombinedReplay = (i != LastIndex);
+		}
+
+		MoveIndex = LastIndex + 1;
+	}
+
+	if (FSavedMove_Character* const PendingMove = ClientData->PendingMove.Get())
+	{
+		PendingMove->bForceNoCombine = true;
+	}
+
+	// Restore saved values.
+	AnalogInputModifier = SavedAnalogInputModifier;
+	RootMotionParams = BackupRootMotionParams;
+	CurrentRootMotion = BackupRootMotion;
+	if (CharacterOwner->bClientResimulateRootMotionSources)
+	{
+		// If we were resimulating root motion sources, it's because we had mismatched state
+		// with the server - we just resimulated our SavedMoves and now need to restore
+		// CurrentRootMotion with the latest "good state"
+		CurrentRootMotion.UpdateStateFrom(CharacterOwner->SavedRootMotion);
+		CharacterOwner->bClientResimulateRootMotionSources = false;
+	}
+	CharacterOwner->SavedRootMotion.Clear();
+	CharacterOwner->bClientResimulateRootMotion = false;
+	CharacterOwner->bClientUpdating = false;
+	CharacterOwner->bPressedJump = bRealJump;
+	bWantsToCrouch = bRealCrouch;
+	bForceMaxAccel = bRealForceMaxAccel;
+	bForceNextFloorCheck = true;
+
+	return (ClientData->SavedMoves.Num() > 0);
+}
+
 bool UVRCharacterMovementComponent::ServerCheckClientErrorVR(float ClientTimeStamp, float DeltaTime, const FVector& Accel, const FVector& ClientWorldLocation, float ClientYaw, const FVector& RelativeClientLocation, UPrimitiveComponent* ClientMovementBase, FName ClientBaseBoneName, uint8 ClientMovementMode)
 {
 	// Check location difference against global setting
@@ -4209,18 +4917,17 @@ bool UVRCharacterMovementComponent::ServerCheckClientErrorVR(float ClientTimeSta
 			RootMotionSourceDebug::PrintOnScreen(*CharacterOwner, AdjustedDebugString);
 		}
 #endif
-		const AGameNetworkManager* GameNetworkManager = (const AGameNetworkManager*)(AGameNetworkManager::StaticClass()->GetDefaultObject());
-		if (GameNetworkManager->ExceedsAllowablePositionError(LocDiff))
+		const CharacterMovementComponentStatics::FServerMoveFrameCache& FrameCache = CharacterMovementComponentStatics::GetServerMoveFrameCache();
+		if (FrameCache.GameNetworkManager->ExceedsAllowablePositionError(LocDiff))
 		{
 			bNetworkLargeClientCorrection = (LocDiff.SizeSquared() > FMath::Square(NetworkLargeClientCorrectionDistance));
 			return true;
 
 		}
 #if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-		static const auto CVarNetForceClientAdjustmentPercent = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetForceClientAdjustmentPercent"));
-		if (CVarNetForceClientAdjustmentPercent->GetFloat() > SMALL_NUMBER)
+		if (FrameCache.ForceClientAdjustmentPercent > SMALL_NUMBER)
 		{
-			if (FMath::SRand() < CVarNetForceClientAdjustmentPercent->GetFloat())
+			if (FMath::SRand() < FrameCache.ForceClientAdjustmentPercent)
 			{
 				UE_LOG(LogVRCharacterMovement, VeryVerbose, TEXT("** ServerCheckClientError forced by p.NetForceClientAdjustmentPercent"));
 				return true;
@@ -4288,6 +4995,10 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 		ClientLoc += BaseLocation;
 	}
 
+	// The compact correction rebuilds from what the client actually sent, keep it before the base can be swapped below
+	UPrimitiveComponent* SentClientMovementBase = ClientMovementBase;
+	const FName SentClientBaseBoneName = ClientBaseBoneName;
+
 	// Client may send a null movement base when walking on bases with no relative location (to save bandwidth).
 	// In this case don't check movement base in error conditions, use the server one (which avoids an error based on differing bases). Position will still be validated.
 	if (ClientMovementBase == nullptr && ClientMovementMode == MOVE_Walking)
@@ -4319,6 +5030,12 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 			//ServerData->PendingAdjustment.NewRot = CharacterOwner->GetBasedMovement().Rotation;
 		}
 
+		// The compact correction has the client reuse its own base and location, so it can only be used if the base and location space match
+		PendingAdjustmentClientLoc = RelativeClientLoc;
+		bPendingAdjustmentCanBeCompact = MovementBase == SentClientMovementBase &&
+			ServerData->PendingAdjustment.NewBaseBoneName == SentClientBaseBoneName &&
+			ServerData->PendingAdjustment.bBaseRelativePosition == MovementBaseUtility::UseRelativeLocation(SentClientMovementBase);
+
 #if !UE_BUILD_SHIPPING
 		static const auto CVarNetShowCorrections = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetShowCorrections"));
 		static const auto CVarNetCorrectionLifetime = IConsoleManager::Get().FindConsoleVariable(TEXT("p.NetCorrectionLifetime"));
@@ -4344,7 +5061,7 @@ void UVRCharacterMovementComponent::ServerMoveHandleClientErrorVR(float ClientTi
 	}
 	else
 	{
-		const AGameNetworkManager* GameNetworkManager = (const AGameNetworkManager*)(AGameNetworkManager::StaticClass()->GetDefaultObject());
+		const AGameNetworkManager* GameNetworkManager = CharacterMovementComponentStatics::GetServerMoveFrameCache().GameNetworkManager;
 		if (GameNetworkManager->ClientAuthorativePosition)
 		{
 			const FVector LocDiff = UpdatedComponent->GetComponentLocation() - ClientLoc; //-V595
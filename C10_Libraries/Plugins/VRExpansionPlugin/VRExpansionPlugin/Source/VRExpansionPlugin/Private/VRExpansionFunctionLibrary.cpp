@@ -123,6 +123,45 @@ void UVRExpansionFunctionLibrary::GetGripSlotInRangeByTypeName_Component(FName S
 	}
 }
 
+static FVRHMDPoseSnapshot HMDPoseSnapshot;
+
+const FVRHMDPoseSnapshot & UVRExpansionFunctionLibrary::GetHMDPoseSnapshot()
+{
+	check(IsInGameThread());
+
+	if (HMDPoseSnapshot.FrameNumber != GFrameCounter)
+	{
+		HMDPoseSnapshot.FrameNumber = GFrameCounter;
+		HMDPoseSnapshot.TimeStamp = FPlatformTime::Seconds();
+		HMDPoseSnapshot.bIsValid = false;
+
+		if (GEngine && GEngine->XRSystem.IsValid())
+		{
+			HMDPoseSnapshot.bIsValid = GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, HMDPoseSnapshot.Orientation, HMDPoseSnapshot.Position);
+		}
+	}
+
+	return HMDPoseSnapshot;
+}
+
+bool UVRExpansionFunctionLibrary::GetHMDPoseForFrame(FQuat & OutOrientation, FVector & OutPosition)
+{
+	if (!IsInGameThread())
+	{
+		return GEngine && GEngine->XRSystem.IsValid() && GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, OutOrientation, OutPosition);
+	}
+
+	const FVRHMDPoseSnapshot & Snapshot = GetHMDPoseSnapshot();
+
+	if (Snapshot.bIsValid)
+	{
+		OutOrientation = Snapshot.Orientation;
+		OutPosition = Snapshot.Position;
+	}
+
+	return Snapshot.bIsValid;
+}
+
 FRotator UVRExpansionFunctionLibrary::GetHMDPureYaw(FRotator HMDRotation)
 {
 	return GetHMDPureYaw_I(HMDRotation);
@@ -1,6 +1,7 @@
 // Copyright 1998-2016 Epic Games, Inc. All Rights Reserved.
 
 #include "VRExpansionPlugin.h"
+#include "VRBPDatatypes.h"
 
 #if WITH_PHYSX
 #include "Grippables/GrippablePhysicsReplication.h"
@@ -13,6 +14,8 @@
 
 #define LOCTEXT_NAMESPACE "FVRExpansionPluginModule"
 
+CSV_DEFINE_CATEGORY_MODULE(VREXPANSIONPLUGIN_API, VRExpansion, false);
+
 void FVRExpansionPluginModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
@@ -2,6 +2,7 @@
 #include "TimerManager.h"
 
 DECLARE_CYCLE_STAT(TEXT("TickGesture ~ TickingGesture"), STAT_TickGesture, STATGROUP_TickGesture);
+DEFINE_LOG_CATEGORY_STATIC(LogVRGesture, Log, All);
 
 UVRGestureComponent::UVRGestureComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -18,6 +19,11 @@ UVRGestureComponent::UVRGestureComponent(const FObjectInitializer& ObjectInitial
 	MirroringHand = EVRGestureMirrorMode::GES_NoMirror;
 	bDrawSplinesCurved = true;
 	bGetGestureInWorldSpace = true;
+	bUseStreamingDetection = false;
+	StreamingGestureSize = 0.0f;
+	StreamSampleCount = 0;
+	StreamingScaler = 1.0f;
+	LastDetectionCells = 0;
 }
 
 void UGesturesDatabase::FillSplineWithGesture(FVRGesture &Gesture, USplineComponent * SplineComponent, bool bCenterPointsOnSpline, bool bScaleToBounds, float OptionalBounds, bool bUseCurvedPoints, bool bFillInSplineMeshComponents, UStaticMesh * Mesh, UMaterial * MeshMat)
@@ -147,6 +153,9 @@ void UVRGestureComponent::BeginRecording(bool bRunDetection, bool bFlattenGestur
 
 	CurrentState = bRunDetection ? EVRGestureState::GES_Detecting : EVRGestureState::GES_Recording;
 
+	if (bRunDetection && bUseStreamingDetection)
+		ResetStreamingDetection();
+
 	if (TargetCharacter != nullptr)
 	{
 		OriginatingTransform = TargetCharacter->OffsetComponentToWorld;
@@ -291,7 +300,16 @@ void UVRGestureComponent::TickGesture()
 	case EVRGestureState::GES_Detecting:
 	{
 		CaptureGestureFrame();
-		RecognizeGesture(GestureLog);
+
+		if (bUseStreamingDetection)
+		{
+			// Only the newest sample needs to go through
+			if (bGestureChanged && GestureLog.Samples.Num() > 0)
+				StreamGestureSample(GestureLog.Samples[0]);
+		}
+		else
+			RecognizeGesture(GestureLog);
+
 		bGestureChanged = false;
 	}break;
 
@@ -315,10 +333,14 @@ void UVRGestureComponent::TickGesture()
 	}
 }
 
-void UVRGestureComponent::RecognizeGesture(FVRGesture inputGesture)
+int32 UVRGestureComponent::RecognizeGesture(FVRGesture inputGesture)
 {
+	LastDetectionCells = 0;
+
 	if (!GesturesDB || inputGesture.Samples.Num() < 1 || !bGestureChanged)
-		return;
+		return -1;
+
+	CSV_SCOPED_TIMING_STAT(VRExpansion, RecognizeGesture);
 
 	float minDist = MAX_FLT;
 
@@ -386,6 +408,183 @@ void UVRGestureComponent::RecognizeGesture(FVRGesture inputGesture)
 		ClearRecording(); // Clear the recording out, we don't want to detect this gesture again with the same data
 		RecordingGestureDraw.Reset();
 	}
+
+	return OutGestureIndex;
+}
+
+FVRGestureStreamState::FVRGestureStreamState(int32 InGestureIndex, bool bInMirrorGesture, int32 TemplateLength)
+{
+	GestureIndex = InGestureIndex;
+	bMirrorGesture = bInMirrorGesture;
+	Distances.SetNumUninitialized(TemplateLength + 1);
+	StartSamples.SetNumUninitialized(TemplateLength + 1);
+	Reset();
+}
+
+void FVRGestureStreamState::Reset()
+{
+	for (int i = 0; i < Distances.Num(); i++)
+	{
+		Distances[i] = MAX_FLT;
+		StartSamples[i] = 0;
+	}
+
+	BestDistance = MAX_FLT;
+	BestStartSample = 0;
+	BestEndSample = 0;
+}
+
+void UVRGestureComponent::ResetStreamingDetection()
+{
+	StreamStates.Reset();
+	StreamSampleCount = 0;
+	StreamingScaler = 1.0f;
+
+	if (!GesturesDB)
+		return;
+
+	bool bNeedsScaling = false;
+
+	for (int i = 0; i < GesturesDB->Gestures.Num(); i++)
+	{
+		FVRGesture &exampleGesture = GesturesDB->Gestures[i];
+
+		if (!exampleGesture.GestureSettings.bEnabled || exampleGesture.Samples.Num() < 1)
+			continue;
+
+		// Same mirroring rules as RecognizeGesture, both mode runs a normal and a mirrored state
+		bool bMirrorGesture = (MirroringHand != EVRGestureMirrorMode::GES_NoMirror && MirroringHand != EVRGestureMirrorMode::GES_MirrorBoth && MirroringHand == exampleGesture.GestureSettings.MirrorMode);
+		StreamStates.Add(FVRGestureStreamState(i, bMirrorGesture, exampleGesture.Samples.Num()));
+
+		if (!bMirrorGesture && exampleGesture.GestureSettings.MirrorMode == EVRGestureMirrorMode::GES_MirrorBoth)
+			StreamStates.Add(FVRGestureStreamState(i, true, exampleGesture.Samples.Num()));
+
+		bNeedsScaling |= exampleGesture.GestureSettings.bEnableScaling;
+	}
+
+	// The size of the buffer isn't known until the gesture is done, so the scale has to be set up front
+	if (StreamingGestureSize > KINDA_SMALL_NUMBER)
+		StreamingScaler = GesturesDB->TargetGestureScale / StreamingGestureSize;
+	else if (bNeedsScaling)
+		UE_LOG(LogVRGesture, Warning, TEXT("%s: streaming detection with scaled gestures needs a StreamingGestureSize, samples will not be scaled"), *GetName());
+}
+
+int32 UVRGestureComponent::StreamGestureSample(const FVector & NewSample)
+{
+	if (!GesturesDB)
+		return -1;
+
+	CSV_SCOPED_TIMING_STAT(VRExpansion, StreamGestureSample);
+
+	const int32 CurSample = ++StreamSampleCount;
+	LastDetectionCells = 0;
+
+	int OutGestureIndex = -1;
+	float minDist = MAX_FLT;
+
+	for (FVRGestureStreamState & State : StreamStates)
+	{
+		// Database was changed under us
+		if (!GesturesDB->Gestures.IsValidIndex(State.GestureIndex) || GesturesDB->Gestures[State.GestureIndex].Samples.Num() != State.Distances.Num() - 1)
+		{
+			ResetStreamingDetection();
+			return -1;
+		}
+
+		FVRGesture &exampleGesture = GesturesDB->Gestures[State.GestureIndex];
+		const int32 TemplateLength = exampleGesture.Samples.Num();
+		const float Threshold = FMath::Square(exampleGesture.GestureSettings.FullThreshold) * TemplateLength;
+		const FVector ScaledSample = NewSample * (exampleGesture.GestureSettings.bEnableScaling ? StreamingScaler : 1.f);
+
+		// Update the column in place, the previous samples value of the cell below is carried along
+		float PrevDiag = State.Distances[0];
+		int32 PrevDiagStart = State.StartSamples[0];
+
+		// Any sample can start a match
+		State.Distances[0] = 0.0f;
+		State.StartSamples[0] = CurSample;
+
+		for (int j = 1; j <= TemplateLength; j++)
+		{
+			const float PrevUp = State.Distances[j];
+			const int32 PrevUpStart = State.StartSamples[j];
+
+			float Best = State.Distances[j - 1];
+			int32 BestStart = State.StartSamples[j - 1];
+
+			if (PrevUp < Best)
+			{
+				Best = PrevUp;
+				BestStart = PrevUpStart;
+			}
+
+			if (PrevDiag < Best)
+			{
+				Best = PrevDiag;
+				BestStart = PrevDiagStart;
+			}
+
+			// Samples are stored newest first, walk the template from its oldest sample
+			State.Distances[j] = Best == MAX_FLT ? MAX_FLT : Best + GetGestureDistance(ScaledSample, exampleGesture.Samples[TemplateLength - j], State.bMirrorGesture);
+			State.StartSamples[j] = BestStart;
+
+			PrevDiag = PrevUp;
+			PrevDiagStart = PrevUpStart;
+		}
+
+		LastDetectionCells += TemplateLength;
+		CSV_CUSTOM_STAT(VRExpansion, StreamGestureCells, TemplateLength, ECsvCustomStatOp::Accumulate);
+
+		// Report the held match once no running alignment that overlaps it can still beat it
+		if (State.BestDistance <= Threshold)
+		{
+			bool bCanImprove = false;
+			for (int j = 1; j <= TemplateLength; j++)
+			{
+				if (State.Distances[j] < State.BestDistance && State.StartSamples[j] <= State.BestEndSample)
+				{
+					bCanImprove = true;
+					break;
+				}
+			}
+
+			if (!bCanImprove)
+			{
+				float d = State.BestDistance / TemplateLength;
+				if (State.BestEndSample - State.BestStartSample + 1 >= exampleGesture.GestureSettings.Minimum_Gesture_Length && d < minDist)
+				{
+					minDist = d;
+					OutGestureIndex = State.GestureIndex;
+				}
+
+				for (int j = 1; j <= TemplateLength; j++)
+				{
+					if (State.StartSamples[j] <= State.BestEndSample)
+						State.Distances[j] = MAX_FLT;
+				}
+
+				State.BestDistance = MAX_FLT;
+			}
+		}
+
+		// Hold on to the best completed alignment
+		if (State.Distances[TemplateLength] <= Threshold && State.Distances[TemplateLength] < State.BestDistance)
+		{
+			State.BestDistance = State.Distances[TemplateLength];
+			State.BestStartSample = State.StartSamples[TemplateLength];
+			State.BestEndSample = CurSample;
+		}
+	}
+
+	if (OutGestureIndex != -1)
+	{
+		OnGestureDetected(GesturesDB->Gestures[OutGestureIndex].GestureType, GesturesDB->Gestures[OutGestureIndex].Name, OutGestureIndex, GesturesDB);
+		OnGestureDetected_Bind.Broadcast(GesturesDB->Gestures[OutGestureIndex].GestureType, GesturesDB->Gestures[OutGestureIndex].Name, OutGestureIndex, GesturesDB);
+		ClearRecording(); // Clear the recording out, we don't want to detect this gesture again with the same data
+		RecordingGestureDraw.Reset();
+	}
+
+	return OutGestureIndex;
 }
 
 float UVRGestureComponent::dtw(FVRGesture seq1, FVRGesture seq2, bool bMirrorGesture, float Scaler)
@@ -401,6 +600,7 @@ float UVRGestureComponent::dtw(FVRGesture seq1, FVRGesture seq2, bool bMirrorGes
 
 	int RowCount = seq1.Samples.Num() + 1;
 	int ColumnCount = seq2.Samples.Num() + 1;
+	LastDetectionCells += seq1.Samples.Num() * seq2.Samples.Num();
 
 	TArray<float> LookupTable;
 	LookupTable.AddZeroed(ColumnCount * RowCount);
@@ -715,6 +915,10 @@ FVRGesture UVRGestureComponent::EndRecording()
 void UVRGestureComponent::ClearRecording()
 {
 	GestureLog.Samples.Reset(RecordingBufferSize);
+	GestureLog.GestureSize.Init();
+
+	if (bUseStreamingDetection && CurrentState == EVRGestureState::GES_Detecting)
+		ResetStreamingDetection();
 }
 
 void UVRGestureComponent::SaveRecording(FVRGesture &Recording, FString RecordingName, bool bScaleRecordingToDatabase)
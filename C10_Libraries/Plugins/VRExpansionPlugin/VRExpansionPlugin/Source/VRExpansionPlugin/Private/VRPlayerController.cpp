@@ -11,6 +11,7 @@ AVRPlayerController::AVRPlayerController(const FObjectInitializer& ObjectInitial
 	: Super(ObjectInitializer)
 {
 	bDisableServerUpdateCamera = true;
+	bBatchClientAuthThrows = true;
 }
 
 void AVRPlayerController::SpawnPlayerCameraManager()
@@ -110,4 +111,26 @@ void AVRPlayerController::PlayerTick(float DeltaTime)
 		// Not our character, forget it
 		Super::PlayerTick(DeltaTime);
 	}
-}
\ No newline at end of file
+}
+
+bool AVRPlayerController::Server_SendClientAuthThrows_Validate(const TArray<FVRClientAuthThrowRep> & ClientAuthThrows)
+{
+	// The client splits its updates to stay under this, anything larger didn't come from us
+	return ClientAuthThrows.Num() <= VR_MAX_CLIENT_AUTH_THROWS_PER_RPC;
+}
+
+void AVRPlayerController::Server_SendClientAuthThrows_Implementation(const TArray<FVRClientAuthThrowRep> & ClientAuthThrows)
+{
+	for (const FVRClientAuthThrowRep & ThrowRep : ClientAuthThrows)
+	{
+		// Only accept updates for objects that this client owns and that were thrown by one of its motion controllers
+		if (ThrowRep.ThrownActor && !ThrowRep.ThrownActor->IsPendingKill() && ThrowRep.ThrownActor->IsOwnedBy(this))
+		{
+			IVRReplicationInterface * ReplicationInterface = Cast<IVRReplicationInterface>(ThrowRep.ThrownActor);
+			if (ReplicationInterface && ReplicationInterface->IsClientAuthThrownBy(this))
+			{
+				ReplicationInterface->ApplyClientAuthReplication(ThrowRep.Movement);
+			}
+		}
+	}
+}
@@ -453,7 +453,7 @@ void UVRRootComponent::TickComponent(float DeltaTime, enum ELevelTick TickType,
 		else if (GEngine->XRSystem.IsValid() && GEngine->XRSystem->IsHeadTrackingAllowed())
 		{
 			FQuat curRot;
-			if (!GEngine->XRSystem->GetCurrentPose(IXRTrackingSystem::HMDDeviceId, curRot, curCameraLoc))
+			if (!UVRExpansionFunctionLibrary::GetHMDPoseForFrame(curRot, curCameraLoc))
 			{
 				curCameraLoc = lastCameraLoc;
 				curCameraRot = lastCameraRot;
@@ -61,10 +61,13 @@ UVRStereoWidgetComponent::UVRStereoWidgetComponent(const FObjectInitializer& Obj
 	, LayerId(0)
 	, LastTransform(FTransform::Identity)
 	, bLastVisible(false)
+	, bHasWidgetDrawn(false)
 {
 	bShouldCreateProxy = true;
 	bLastWidgetDrew = false;
 	bUseEpicsWorldLockedStereo = false;
+	LayerTransformTolerance = 0.01f;
+	LayerRotationTolerance = 0.01f;
 	// Replace quad size with DrawSize instead
 	//StereoLayerQuadSize = DrawSize;
 
@@ -256,159 +259,205 @@ void UVRStereoWidgetComponent::TickComponent(float DeltaTime, enum ELevelTick Ti
 		}
 	}
 
-	// If the transform changed dirty the layer and push the new transform
-	if (!bIsDirty && (bLastVisible != bVisible || bWidgetDrew != bLastWidgetDrew || FMemory::Memcmp(&LastTransform, &Transform, sizeof(Transform)) != 0))
+	bool bCurrVisible = bVisible;
+	if (!RenderTarget || !RenderTarget->Resource)
 	{
-		bIsDirty = true;
+		bCurrVisible = false;
 	}
 
-	bool bCurrVisible = bVisible;
-	if (!RenderTarget || !RenderTarget->Resource || !bWidgetDrew)
+	// Nothing to show until the widget has drawn into the render target at least once
+	if (bWidgetDrew)
+	{
+		bHasWidgetDrawn = true;
+	}
+	else if (!bHasWidgetDrawn)
 	{
 		bCurrVisible = false;
 	}
 
 	bLastWidgetDrew = bWidgetDrew;
 
-	if (bIsDirty)
+	UpdateStereoLayer(*StereoLayers, Transform, bCurrVisible, bWidgetDrew);
+#endif
+}
+
+void UVRStereoWidgetComponent::UpdateStereoLayer(IStereoLayers & StereoLayers, const FTransform & Transform, bool bCurrVisible, bool bWidgetDrew)
+{
+	if (!bCurrVisible)
 	{
-		if (!bCurrVisible)
+		if (LayerId)
 		{
-			if (LayerId)
-			{
-				StereoLayers->DestroyLayer(LayerId);
-				LayerId = 0;
-			}
+			StereoLayers.DestroyLayer(LayerId);
+			LayerId = 0;
 		}
-		else
+	}
+	else
+	{
+		IStereoLayers::FLayerDesc LayerDsec;
+		BuildLayerDesc(Transform, LayerDsec);
+
+		if (!LayerId)
 		{
-			IStereoLayers::FLayerDesc LayerDsec;
-			LayerDsec.Priority = Priority;
-			LayerDsec.QuadSize = FVector2D(DrawSize);//StereoLayerQuadSize;
+			LayerId = StereoLayers.CreateLayer(LayerDsec);
+			LastLayerDesc = LayerDsec;
+			LastTransform = Transform;
+			bTextureNeedsUpdate = true;
+		}
+		// Only re-send the layer when something in it actually changed, not for every bit of head / pawn jitter
+		else if (bIsDirty || !IsLayerDescNearlyEqual(LastLayerDesc, LayerDsec))
+		{
+			CSV_CUSTOM_STAT(VRExpansion, StereoLayerDescUpdates, 1, ECsvCustomStatOp::Accumulate);
+			StereoLayers.SetLayerDesc(LayerId, LayerDsec);
+			LastLayerDesc = LayerDsec;
+			LastTransform = Transform;
+		}
 
-			/*if (DrawSize.X != DrawSize.Y)
-			{
-				// This might be a SteamVR only thing, it appears to always make the quad the largest of the two on the back end
-				if (DrawSize.X > DrawSize.Y) 
-					LayerDsec.QuadSize.Y = LayerDsec.QuadSize.X;
-				else
-					LayerDsec.QuadSize.X = LayerDsec.QuadSize.Y;
-			}*/
+		// The compositor only needs to copy the render target on frames it was redrawn
+		if (bWidgetDrew)
+		{
+			bTextureNeedsUpdate = true;
+		}
+	}
 
-			LayerDsec.UVRect = UVRect;
-			LayerDsec.Transform = Transform;
-			if (RenderTarget)
-			{
-				LayerDsec.Texture = RenderTarget->Resource->TextureRHI;
-			}
-			// Forget the left texture implementation
-			//if (LeftTexture)
-			//{
-			//	LayerDsec.LeftTexture = LeftTexture->Resource->TextureRHI;
-			//}
+	bLastVisible = bCurrVisible;
+	bIsDirty = false;
 
+	if (bTextureNeedsUpdate && LayerId)
+	{
+		CSV_CUSTOM_STAT(VRExpansion, StereoLayerTextureUpdates, 1, ECsvCustomStatOp::Accumulate);
+		StereoLayers.MarkTextureForUpdate(LayerId);
+		bTextureNeedsUpdate = false;
+	}
+}
 
-			const float ArcAngleRadians = FMath::DegreesToRadians(CylinderArcAngle);
-			const float Radius = GetDrawSize().X / ArcAngleRadians;
+void UVRStereoWidgetComponent::BuildLayerDesc(const FTransform& Transform, IStereoLayers::FLayerDesc& LayerDsec) const
+{
+	LayerDsec.Priority = Priority;
+	LayerDsec.QuadSize = FVector2D(DrawSize);//StereoLayerQuadSize;
 
-			//LayerDsec.CylinderSize = FVector2D(/*CylinderRadius*/Radius, /*CylinderOverlayArc*/CylinderArcAngle);
-			LayerDsec.CylinderRadius = Radius;
-			LayerDsec.CylinderOverlayArc = CylinderArcAngle;
+	/*if (DrawSize.X != DrawSize.Y)
+	{
+		// This might be a SteamVR only thing, it appears to always make the quad the largest of the two on the back end
+		if (DrawSize.X > DrawSize.Y) 
+			LayerDsec.QuadSize.Y = LayerDsec.QuadSize.X;
+		else
+			LayerDsec.QuadSize.X = LayerDsec.QuadSize.Y;
+	}*/
 
-			// This needs to be auto set from variables, need to work on it
-			LayerDsec.CylinderHeight = GetDrawSize().Y;//CylinderHeight;
+	LayerDsec.UVRect = UVRect;
+	LayerDsec.Transform = Transform;
+	if (RenderTarget)
+	{
+		LayerDsec.Texture = RenderTarget->Resource->TextureRHI;
+	}
+	// Forget the left texture implementation
+	//if (LeftTexture)
+	//{
+	//	LayerDsec.LeftTexture = LeftTexture->Resource->TextureRHI;
+	//}
 
-			LayerDsec.Flags |= IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE;// (/*bLiveTexture*/true) ? IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE : 0;
-			LayerDsec.Flags |= (bNoAlphaChannel) ? IStereoLayers::LAYER_FLAG_TEX_NO_ALPHA_CHANNEL : 0;
-			LayerDsec.Flags |= (bQuadPreserveTextureRatio) ? IStereoLayers::LAYER_FLAG_QUAD_PRESERVE_TEX_RATIO : 0;
-			LayerDsec.Flags |= (bSupportsDepth) ? IStereoLayers::LAYER_FLAG_SUPPORT_DEPTH : 0;
 
-			// Fix this later when WorldLocked is no longer wrong.
-			switch (Space)
-			{
-			case EWidgetSpace::World:
-			{
-				if(bUseEpicsWorldLockedStereo)
-					LayerDsec.PositionType = IStereoLayers::WorldLocked;
-				else
-					LayerDsec.PositionType = IStereoLayers::TrackerLocked;
+	const float ArcAngleRadians = FMath::DegreesToRadians(CylinderArcAngle);
+	const float Radius = GetDrawSize().X / ArcAngleRadians;
 
-				//LayerDsec.Flags |= IStereoLayers::LAYER_FLAG_SUPPORT_DEPTH;
-			}break;
+	//LayerDsec.CylinderSize = FVector2D(/*CylinderRadius*/Radius, /*CylinderOverlayArc*/CylinderArcAngle);
+	LayerDsec.CylinderRadius = Radius;
+	LayerDsec.CylinderOverlayArc = CylinderArcAngle;
 
-			case EWidgetSpace::Screen:
-			default:
-			{
-				LayerDsec.PositionType = IStereoLayers::FaceLocked;
-			}break;
-			}
+	// This needs to be auto set from variables, need to work on it
+	LayerDsec.CylinderHeight = GetDrawSize().Y;//CylinderHeight;
 
-			/*switch (StereoLayerType)
-			{
-			case SLT_WorldLocked:
-				LayerDsec.PositionType = IStereoLayers::WorldLocked;
-				break;
-			case SLT_TrackerLocked:
-				LayerDsec.PositionType = IStereoLayers::TrackerLocked;
-				break;
-			case SLT_FaceLocked:
-				LayerDsec.PositionType = IStereoLayers::FaceLocked;
-				break;
-			}*/
+	// No continuous update flag, the texture is marked for update on the frames the widget actually drew
+	LayerDsec.Flags |= (bNoAlphaChannel) ? IStereoLayers::LAYER_FLAG_TEX_NO_ALPHA_CHANNEL : 0;
+	LayerDsec.Flags |= (bQuadPreserveTextureRatio) ? IStereoLayers::LAYER_FLAG_QUAD_PRESERVE_TEX_RATIO : 0;
+	LayerDsec.Flags |= (bSupportsDepth) ? IStereoLayers::LAYER_FLAG_SUPPORT_DEPTH : 0;
 
-			switch (GeometryMode)
-			{
-			case EWidgetGeometryMode::Cylinder:
-			{
-				LayerDsec.ShapeType = IStereoLayers::CylinderLayer;
-			}break;
-			case EWidgetGeometryMode::Plane:
-			default:
-			{
-				LayerDsec.ShapeType = IStereoLayers::QuadLayer;
-			}break;
-			}
+	// Fix this later when WorldLocked is no longer wrong.
+	switch (Space)
+	{
+	case EWidgetSpace::World:
+	{
+		if(bUseEpicsWorldLockedStereo)
+			LayerDsec.PositionType = IStereoLayers::WorldLocked;
+		else
+			LayerDsec.PositionType = IStereoLayers::TrackerLocked;
 
-			// Can't use the cubemap with widgets currently, maybe look into it?
-			/*switch (StereoLayerShape)
-			{
-			case SLSH_QuadLayer:
-				LayerDsec.ShapeType = IStereoLayers::QuadLayer;
-				break;
-
-			case SLSH_CylinderLayer:
-				LayerDsec.ShapeType = IStereoLayers::CylinderLayer;
-				break;
-
-			case SLSH_CubemapLayer:
-				LayerDsec.ShapeType = IStereoLayers::CubemapLayer;
-				break;
-			default:
-				break;
-			}*/
+		//LayerDsec.Flags |= IStereoLayers::LAYER_FLAG_SUPPORT_DEPTH;
+	}break;
 
-			if (LayerId)
-			{
-				StereoLayers->SetLayerDesc(LayerId, LayerDsec);
-			}
-			else
-			{
-				LayerId = StereoLayers->CreateLayer(LayerDsec);
-			}
-		}
-		LastTransform = Transform;
-		bLastVisible = bCurrVisible;
-		bIsDirty = false;
+	case EWidgetSpace::Screen:
+	default:
+	{
+		LayerDsec.PositionType = IStereoLayers::FaceLocked;
+	}break;
 	}
 
-	if (bTextureNeedsUpdate && LayerId)
+	/*switch (StereoLayerType)
 	{
-		StereoLayers->MarkTextureForUpdate(LayerId);
-		bTextureNeedsUpdate = false;
+	case SLT_WorldLocked:
+		LayerDsec.PositionType = IStereoLayers::WorldLocked;
+		break;
+	case SLT_TrackerLocked:
+		LayerDsec.PositionType = IStereoLayers::TrackerLocked;
+		break;
+	case SLT_FaceLocked:
+		LayerDsec.PositionType = IStereoLayers::FaceLocked;
+		break;
+	}*/
+
+	switch (GeometryMode)
+	{
+	case EWidgetGeometryMode::Cylinder:
+	{
+		LayerDsec.ShapeType = IStereoLayers::CylinderLayer;
+	}break;
+	case EWidgetGeometryMode::Plane:
+	default:
+	{
+		LayerDsec.ShapeType = IStereoLayers::QuadLayer;
+	}break;
 	}
-#endif
+
+	// Can't use the cubemap with widgets currently, maybe look into it?
+	/*switch (StereoLayerShape)
+	{
+	case SLSH_QuadLayer:
+		LayerDsec.ShapeType = IStereoLayers::QuadLayer;
+		break;
+
+	case SLSH_CylinderLayer:
+		LayerDsec.ShapeType = IStereoLayers::CylinderLayer;
+		break;
+
+	case SLSH_CubemapLayer:
+		LayerDsec.ShapeType = IStereoLayers::CubemapLayer;
+		break;
+	default:
+		break;
+	}*/
 }
 
+bool UVRStereoWidgetComponent::IsLayerDescNearlyEqual(const IStereoLayers::FLayerDesc& A, const IStereoLayers::FLayerDesc& B) const
+{
+	if (A.Priority != B.Priority || A.PositionType != B.PositionType || A.ShapeType != B.ShapeType || A.Flags != B.Flags)
+		return false;
+
+	if (A.Texture.GetReference() != B.Texture.GetReference())
+		return false;
+
+	if (A.QuadSize != B.QuadSize || A.UVRect.Min != B.UVRect.Min || A.UVRect.Max != B.UVRect.Max)
+		return false;
+
+	if (A.CylinderRadius != B.CylinderRadius || A.CylinderOverlayArc != B.CylinderOverlayArc || A.CylinderHeight != B.CylinderHeight)
+		return false;
+
+	if (!A.Transform.TranslationEquals(B.Transform, LayerTransformTolerance) || !A.Transform.Scale3DEquals(B.Transform, KINDA_SMALL_NUMBER))
+		return false;
+
+	// Sin of the half angle from the vector part, stays precise for tiny angles where the acos in AngularDistance doesn't
+	const FQuat DeltaRot = A.Transform.GetRotation().Inverse() * B.Transform.GetRotation();
+	return FVector(DeltaRot.X, DeltaRot.Y, DeltaRot.Z).SizeSquared() <= FMath::Square(FMath::Sin(FMath::DegreesToRadians(LayerRotationTolerance) * 0.5f));
+}
 
 void UVRStereoWidgetComponent::SetPriority(int32 InPriority)
 {
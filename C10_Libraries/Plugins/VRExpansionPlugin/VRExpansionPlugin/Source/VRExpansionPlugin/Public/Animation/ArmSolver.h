@@ -3,11 +3,53 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "VRBPDatatypes.h"
-#include "ActorComponent.h"
 //#include "ArmSolver.generated.h"
 
+// Result of solving a single arm, rotations are world space with X down the bone and Z towards the elbow pole
+struct VREXPANSIONPLUGIN_API FArmSolverResult
+{
+	FVector ShoulderLocation;
+	FVector ElbowLocation;
+	FVector WristLocation;
+	FQuat UpperArmRotation;
+	FQuat LowerArmRotation;
+	FQuat HandRotation;
+
+	// Angle around the shoulder to hand axis, 0 is the elbow straight up and 180 straight down
+	float ElbowAngle;
+
+	// True if the controller was further away than the arm could reach
+	bool bAtReachLimit;
+};
+
+// Structure of arrays for solving many arms at once, one entry per arm (AddAvatar adds the left and right arms)
+struct VREXPANSIONPLUGIN_API FArmSolverBatch
+{
+	// Inputs
+	TArray<FVector> HMDLocations;
+	TArray<FQuat> HMDRotations;
+	TArray<FVector> ControllerLocations;
+	TArray<FQuat> ControllerRotations;
+	TArray<bool> IsLeftArm;
+
+	// Outputs
+	TArray<FVector> ElbowLocations;
+	TArray<FVector> WristLocations;
+	TArray<FQuat> UpperArmRotations;
+	TArray<FQuat> LowerArmRotations;
+	TArray<FQuat> HandRotations;
+
+	int32 Num() const { return HMDLocations.Num(); }
+
+	void Reset(int32 ExpectedArms = 0);
+
+	// Adds both arms of an avatar, returns the index of the left arm (right is +1)
+	int32 AddAvatar(const FTransform & HMDTransform, const FTransform & LeftControllerTransform, const FTransform & RightControllerTransform);
+};
 
-class ArmSolver
+// Analytic two bone arm IK driven by the HMD and a controller
+// Elbow placement weights are from the VRArmIK approach, hand position in the shoulder frame drives the elbow angle
+class VREXPANSIONPLUGIN_API ArmSolver
 {
 
 public:
@@ -21,15 +63,39 @@ public:
 	float zWeightTop, zWeightBottom, zBorderY, zDistanceStart;
 	float xWeight, xDistanceStart;
 
+	// Arm lengths in cm
+	float upperArmLength, lowerArmLength;
+
+	// Offset from the HMD to the point between the shoulders, in the HMD yaw frame
+	FVector headToShoulderCenter;
+	float shoulderWidth;
+
 	ArmSolver()
 	{
 		calcElbowAngle = true;
 		clampElbowAngle = true;
-		softClampElbowAngle = true;	
-		maxAngle = 175f, minAngle = 13f, softClampRange = 10f;
-		offsetAngle = 135f;
-		yWeight = -60f;                                                                
-		zWeightTop = 260, zWeightBottom = -100, zBorderY = -.25f, zDistanceStart = .6f;
-		xWeight = -50f, xDistanceStart = .1f;
+		softClampElbowAngle = true;
+		maxAngle = 175.f, minAngle = 13.f, softClampRange = 10.f;
+		offsetAngle = 135.f;
+		yWeight = -60.f;
+		zWeightTop = 260.f, zWeightBottom = -100.f, zBorderY = -.25f, zDistanceStart = .6f;
+		xWeight = -50.f, xDistanceStart = .1f;
+
+		upperArmLength = 30.f, lowerArmLength = 28.f;
+		headToShoulderCenter = FVector(-10.f, 0.f, -25.f);
+		shoulderWidth = 36.f;
 	}
-};
\ No newline at end of file
+
+	// Solves a single arm
+	void SolveArm(const FTransform & HMDTransform, const FTransform & ControllerTransform, bool bLeftArm, FArmSolverResult & OutResult) const;
+
+	// Solves every arm in the batch, only reads the settings and the batch so it is safe to call off of the game thread
+	void SolveBatch(FArmSolverBatch & Batch, bool bUseParallelFor = false) const;
+
+	// Elbow angle for a hand position in the shoulder frame, normalized by the total arm length
+	float GetElbowTargetAngle(const FVector & LocalHandPosNormalized, bool bLeftArm) const;
+
+private:
+
+	void SolveArm_Internal(const FVector & HMDLocation, const FQuat & HMDRotation, const FVector & ControllerLocation, const FQuat & ControllerRotation, bool bLeftArm, FArmSolverResult & OutResult) const;
+};
@@ -42,6 +42,72 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FVRGripControllerOnGripOutOfRange,
 /** Delegate for notification when the controller profile transform changes. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FVRGripControllerOnProfileTransformChanged, const FTransform &, NewRelTransForProcComps, const FTransform &, NewProfileTransform);
 
+// Max number of samples held in the controllers velocity history, 30 frames is ~0.33 seconds at 90htz
+#define VR_VELOCITY_HISTORY_MAX_SAMPLES 30
+
+/**
+* Fixed size ring buffer of timestamped controller poses, used to get a least squares velocity over a time window
+* instead of relying on a single (noisy) frame difference. Never allocates after construction.
+*/
+struct VREXPANSIONPLUGIN_API FVRVelocityHistory
+{
+public:
+
+	struct FVelocitySample
+	{
+		double TimeStamp;
+		FVector Location;
+		FQuat Rotation;
+	};
+
+	FVRVelocityHistory() :
+		NextIndex(0),
+		NumSamples(0)
+	{}
+
+	// Adds a new sample, overwriting the oldest one if the buffer is full
+	void AddSample(double TimeStamp, const FVector& Location, const FQuat& Rotation);
+
+	// Clears all samples, call this on teleport so that the jump isn't counted as velocity
+	void Reset()
+	{
+		NextIndex = 0;
+		NumSamples = 0;
+	}
+
+	int32 Num() const
+	{
+		return NumSamples;
+	}
+
+	// Least squares linear velocity (units per second) over the samples within TimeWindow seconds of the newest sample
+	// Returns false if there aren't enough samples to compute it
+	bool GetLinearVelocity(float TimeWindow, FVector& OutVelocity) const;
+
+	// Least squares angular velocity (degrees per second around each axis) over the samples within TimeWindow seconds of the newest sample
+	// Returns false if there aren't enough samples to compute it
+	bool GetAngularVelocity(float TimeWindow, FVector& OutAngularVelocity) const;
+
+	// Velocity (units per second) between the two newest samples, ignores the time window
+	// Returns false if there aren't two samples yet
+	bool GetLastFrameVelocity(FVector& OutVelocity) const;
+
+private:
+
+	// Gets a sample by age, 0 is the newest
+	FORCEINLINE const FVelocitySample& GetSampleByAge(int32 Age) const
+	{
+		return Samples[(NextIndex - 1 - Age + VR_VELOCITY_HISTORY_MAX_SAMPLES) % VR_VELOCITY_HISTORY_MAX_SAMPLES];
+	}
+
+	// Number of samples within the time window of the newest sample
+	int32 GetNumSamplesInWindow(float TimeWindow) const;
+
+	FVelocitySample Samples[VR_VELOCITY_HISTORY_MAX_SAMPLES];
+	int32 NextIndex;
+	int32 NumSamples;
+};
+
 /**
 * Utility class for applying an offset to a hierarchy of components in the renderer thread.
 */
@@ -111,6 +177,36 @@ public:
 	FVector LastLocationForLateUpdate;
 	FTransform LastRelativePosition;
 
+	// If true will store a short history of world space poses for this controller in TickGrip
+	// Used for the least squares velocity functions, which are far more stable for throwing than the single frame ComponentVelocity
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Velocity")
+		bool bSampleVelocityHistory;
+
+	// The time window in seconds to use for the velocity history functions, capped by the max sample count of the history (30 frames)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GripMotionController|Velocity", meta = (ClampMin = "0.0", UIMin = "0.0", ClampMax = "0.5", UIMax = "0.5"))
+		float VelocityHistoryWindow;
+
+	// Running time used to timestamp the velocity history samples
+	double VelocityHistoryTime;
+
+	// Ring buffer of recent world space poses
+	FVRVelocityHistory VelocityHistory;
+
+	// Gets the least squares linear velocity (world space) of the controller over the last VelocityHistoryWindow seconds
+	// Returns false if there isn't enough history in the window, LinearVelocity is then the world space velocity between the last two samples
+	// or the single frame ComponentVelocity converted to world space if there aren't two samples yet
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController|Velocity")
+		bool GetLinearVelocityFromHistory(FVector& LinearVelocity);
+
+	// Gets the least squares angular velocity (world space, degrees per second) of the controller over the last VelocityHistoryWindow seconds
+	// Returns false if there isn't enough history yet
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController|Velocity")
+		bool GetAngularVelocityFromHistory(FVector& AngularVelocity);
+
+	// Clears the velocity history, it is automatically cleared on teleport
+	UFUNCTION(BlueprintCallable, Category = "GripMotionController|Velocity")
+		void ResetVelocityHistory();
+
 	// If true will offset the tracked location of the controller by the controller profile that is currently loaded.
 	// Thows the event OnControllerProfileTransformChanged when it happens so that you can adjust specific components
 	// Like procedural ones for the offset (procedural meshes are already correctly offset for the controller and
@@ -9,6 +9,31 @@
 
 class UGripMotionControllerComponent;
 
+// Event thrown when the swept melee collision hits something, bone and normal are in the hit result
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FVRMeleeSweepHitSignature, const FHitResult &, Hit, FVector, ImpactVelocity, float, ImpactSpeed);
+
+// Grip IDs are only unique per controller, so the last swept pose is keyed by both
+struct FVRMeleeSweepKey
+{
+	TWeakObjectPtr<UGripMotionControllerComponent> Controller;
+	uint8 GripID;
+
+	FVRMeleeSweepKey(UGripMotionControllerComponent * InController, uint8 InGripID) :
+		Controller(InController),
+		GripID(InGripID)
+	{}
+
+	bool operator==(const FVRMeleeSweepKey & Other) const
+	{
+		return GripID == Other.GripID && Controller == Other.Controller;
+	}
+
+	friend uint32 GetTypeHash(const FVRMeleeSweepKey & Key)
+	{
+		return HashCombine(GetTypeHash(Key.Controller), Key.GripID);
+	}
+};
+
 // A grip script that adds useful melee functions and capabilities
 // Just adding it to the grippable object provides the features without removing standard
 // Grip features.
@@ -18,23 +43,40 @@ class VREXPANSIONPLUGIN_API UGS_MeleeTools : public UGS_Default
 	GENERATED_BODY()
 public:
 
-	// Hit event data
-	// Hit bone / if skeletal mesh
-	// Attachment data and normal of allowed penetration removal
+	UGS_MeleeTools(const FObjectInitializer& ObjectInitializer);
 
-	UGS_MeleeTools(const FObjectInitializer& ObjectInitializer)
-	: Super(ObjectInitializer)
-	{}
+	// Sweeps the simple collision of the gripped primitive from last frames pose to this frames pose while held
+	// Catches fast swings that would tunnel through thin objects without needing CCD on the object
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeleeSettings")
+		bool bUseSweptHitDetection;
 
-	virtual void OnGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation) override
-	{
-		//GetOwner and get if a prim comp, if so then bind to its overlap / hit event if we aren't custom tracing it
-	}
+	// Maximum rotation in degrees covered by a single sweep, faster swings are split into more sub steps
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeleeSettings", meta = (ClampMin = "1.0", UIMin = "1.0"))
+		float MaxSubstepAngle;
+
+	// Upper limit on the number of sweeps per frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeleeSettings", meta = (ClampMin = "1", UIMin = "1"))
+		int32 MaxSubsteps;
+
+	// Hits with a lower impact speed than this (cm/s) are not reported
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "MeleeSettings", meta = (ClampMin = "0.0", UIMin = "0.0"))
+		float MinimumImpactSpeed;
+
+	// Called for each component hit by the swept collision, once per frame per component
+	UPROPERTY(BlueprintAssignable, Category = "MeleeEvents")
+		FVRMeleeSweepHitSignature OnMeleeSweepHit;
+
+	virtual void OnGrip_Implementation(UGripMotionControllerComponent * GrippingController, const FBPActorGripInformation & GripInformation) override;
+	virtual void OnGripRelease_Implementation(UGripMotionControllerComponent * ReleasingController, const FBPActorGripInformation & GripInformation, bool bWasSocketed = false) override;
 	virtual void OnSecondaryGrip_Implementation(UGripMotionControllerComponent * Controller, USceneComponent * SecondaryGripComponent, const FBPActorGripInformation & GripInformation) override
 	{}
-	virtual bool GetWorldTransform_Implementation(UGripMotionControllerComponent * GrippingController, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport) override
-	{
-		return true;
-	}
-};
+	virtual bool GetWorldTransform_Implementation(UGripMotionControllerComponent * GrippingController, float DeltaTime, FTransform & WorldTransform, const FTransform &ParentTransform, FBPActorGripInformation &Grip, AActor * actor, UPrimitiveComponent * root, bool bRootHasInterface, bool bActorHasInterface, bool bIsForTeleport) override;
 
+protected:
+
+	// Sweeps the primitive between the two poses, returns the number of sweeps used
+	int32 SweepMeleeCollision(UGripMotionControllerComponent * GrippingController, UPrimitiveComponent * root, AActor * actor, const FTransform & FromTransform, const FTransform & ToTransform, float DeltaTime);
+
+	// Pose each grip was last swept to, one object can be held by more than one hand
+	TMap<FVRMeleeSweepKey, FTransform> LastSweptTransforms;
+};
@@ -0,0 +1,37 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/Function.h"
+#include "Grippables/GrippablePhysicsReplication.h"
+
+class UVRGripScriptBase;
+class UGripMotionControllerComponent;
+class AController;
+class UActorChannel;
+class FOutBunch;
+struct FReplicationFlags;
+
+/**
+* Logic that is shared between all of the grippable actors and components.
+* Kept here so that each grippable class isn't carrying its own copy of the replication and client auth throwing code.
+*/
+struct VREXPANSIONPLUGIN_API FVRGrippableCore
+{
+	// Replicates the grip logic scripts as sub objects of the channel, skips out early if there are none
+	static bool ReplicateGripScripts(const TArray<UVRGripScriptBase *> & GripLogicScripts, UActorChannel* Channel, FOutBunch *Bunch, FReplicationFlags *RepFlags);
+
+	// Called from SetHeld, starts a client auth throw on release or ends the current one on grip
+	static void SetHeldClientAuth(AActor * GrippableActor, FVRClientAuthReplicationData & ClientAuthData, UGripMotionControllerComponent * HoldingController, bool bIsHeld, bool bSkipAttachmentReplication);
+
+	// Server side check for batched throw updates, the object has to be released and its last grip has to be from one of the sending controllers motion controllers
+	static bool IsClientAuthThrownBy(const FVRClientAuthReplicationData & ClientAuthData, bool bIsHeld, AController * SendingController);
+
+	// Runs the replication manager poll for a client auth throw, returns if it still wants to be polled
+	// SendOwnRPC is used if the throw can't be batched on the owning controller
+	static bool PollClientAuthThrow(AActor * GrippableActor, FVRClientAuthReplicationData & ClientAuthData, bool bSkipAttachmentReplication, TFunctionRef<void(const FRepMovementVR &)> SendOwnRPC);
+
+	// Stops blocking server movement replication and frees the throwing state
+	static void CeaseClientAuthThrow(FVRClientAuthReplicationData & ClientAuthData);
+};
@@ -10,6 +10,7 @@
 #include "Delegates/DelegateInstanceInterface.h"
 #include "Templates/TypeWrapper.h"
 #include "Misc/Crc.h"
+#include "Templates/Function.h"
 #include "UObject/NameTypes.h"	
 #include "UObject/ObjectMacros.h"
 #include "UObject/Interface.h"
@@ -32,6 +33,9 @@
 
 //DECLARE_DYNAMIC_MULTICAST_DELEGATE(FVRPhysicsReplicationDelegate, void, Return);
 
+struct FRepMovementVR;
+class UGripMotionControllerComponent;
+
 /*static TAutoConsoleVariable<int32> CVarEnableCustomVRPhysicsReplication(
 	TEXT("vr.VRExpansion.EnableCustomVRPhysicsReplication"),
 	0,
@@ -56,9 +60,145 @@ public:
 	// Runs the replication tick, returns if replication is still ongoing
 	virtual bool PollReplicationEvent(float DeltaTime) = 0;
 
+	// Server side, applies a client authed movement update to the object
+	virtual void ApplyClientAuthReplication(const FRepMovementVR & NewMovement) {}
+
+	// Server side, if the object is in a throw from a motion controller of this controller (released by it and not re-gripped)
+	virtual bool IsClientAuthThrownBy(AController * SendingController) const { return false; }
+
 
 	static bool AddObjectToReplicationManager(uint32 UpdateHTZ, UObject * ObjectToAdd);
 	static bool RemoveObjectFromReplicationManager(UObject * ObjectToRemove);
+
+	// Queues a client auth throw update to be sent along with all of the owning controllers other throws this tick
+	// Returns false if the top owner isn't a VRPlayerController, the caller should send its own RPC in that case
+	static bool QueueClientAuthThrow(AActor * ThrownActor, const FRepMovementVR & NewMovement);
+};
+
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FRepMovementVR : public FRepMovement
+{
+	GENERATED_USTRUCT_BODY()
+public:
+
+		FRepMovementVR() : FRepMovement()
+		{
+			LocationQuantizationLevel = EVectorQuantization::RoundTwoDecimals;
+			VelocityQuantizationLevel = EVectorQuantization::RoundTwoDecimals;
+			RotationQuantizationLevel = ERotatorQuantization::ShortComponents;
+		}
+
+		FRepMovementVR(FRepMovement & other) : FRepMovement()
+		{
+			FRepMovementVR();
+
+			LinearVelocity = other.LinearVelocity;
+			AngularVelocity = other.AngularVelocity;
+			Location = other.Location;
+			Rotation = other.Rotation;
+			bSimulatedPhysicSleep = other.bSimulatedPhysicSleep;
+			bRepPhysics = other.bRepPhysics;
+		}
+		
+		void CopyTo(FRepMovement &other) const
+		{
+			other.LinearVelocity = LinearVelocity;
+			other.AngularVelocity = AngularVelocity;
+			other.Location = Location;
+			other.Rotation = Rotation;
+			other.bSimulatedPhysicSleep = bSimulatedPhysicSleep;
+			other.bRepPhysics = bRepPhysics;
+		}
+
+		bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+		{
+			return FRepMovement::NetSerialize(Ar, Map, bOutSuccess);
+		}
+
+		bool GatherActorsMovement(AActor * OwningActor)
+		{
+			//if (/*bReplicateMovement || (RootComponent && RootComponent->GetAttachParent())*/)
+			{
+				UPrimitiveComponent* RootPrimComp = Cast<UPrimitiveComponent>(OwningActor->GetRootComponent());
+				if (RootPrimComp && RootPrimComp->IsSimulatingPhysics())
+				{
+					FRigidBodyState RBState;
+					RootPrimComp->GetRigidBodyState(RBState);
+
+					FillFrom(RBState, OwningActor);
+					// Don't replicate movement if we're welded to another parent actor.
+					// Their replication will affect our position indirectly since we are attached.
+					bRepPhysics = !RootPrimComp->IsWelded();
+				}
+				else if (RootPrimComp != nullptr)
+				{
+					// If we are attached, don't replicate absolute position, use AttachmentReplication instead.
+					if (RootPrimComp->GetAttachParent() != nullptr)
+					{
+						return false; // We don't handle attachment rep
+
+					}
+					else
+					{
+						Location = FRepMovement::RebaseOntoZeroOrigin(RootPrimComp->GetComponentLocation(), OwningActor);
+						Rotation = RootPrimComp->GetComponentRotation();
+						LinearVelocity = OwningActor->GetVelocity();
+						AngularVelocity = FVector::ZeroVector;
+					}
+
+					bRepPhysics = false;
+				}
+			}
+
+			/*if (const UWorld* World = GetOwningWorld())
+			{
+				if (APlayerController* PlayerController = World->GetFirstPlayerController())
+				{
+					if (APlayerState* PlayerState = PlayerController->PlayerState)
+					{
+						CurrentPing = PlayerState->ExactPing;
+					}
+				}
+			}*/
+
+			return true;
+		}
+};
+
+template<>
+struct TStructOpsTypeTraits<FRepMovementVR> : public TStructOpsTypeTraitsBase2<FRepMovementVR>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithNetSharedSerialization = true,
+	};
+};
+
+// Max throw updates in a single batched RPC, the server rejects anything larger and the client splits its updates to stay under it
+#define VR_MAX_CLIENT_AUTH_THROWS_PER_RPC 32
+
+// A single client authed throw update, many of these are batched into one RPC on the owning controller
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRClientAuthThrowRep
+{
+	GENERATED_BODY()
+public:
+
+	UPROPERTY()
+		AActor * ThrownActor;
+
+	UPROPERTY()
+		FRepMovementVR Movement;
+
+	FVRClientAuthThrowRep() :
+		ThrownActor(nullptr)
+	{}
+
+	FVRClientAuthThrowRep(AActor * InThrownActor, const FRepMovementVR & InMovement) :
+		ThrownActor(InThrownActor),
+		Movement(InMovement)
+	{}
 };
 
 USTRUCT()
@@ -122,6 +262,13 @@ public:
 	bool bNeedsUpdate;
 	TMap<uint32, FReplicationBucket> ReplicationBuckets;
 
+	// Client auth throws gathered during this update, sent as one RPC per owning controller once the buckets are done
+	TMap<TWeakObjectPtr<APlayerController>, TArray<FVRClientAuthThrowRep>> PendingClientAuthThrows;
+	void FlushClientAuthThrows();
+
+	// Passes the throws to SendRPC in batches of at most VR_MAX_CLIENT_AUTH_THROWS_PER_RPC
+	static void BatchClientAuthThrows(const TArray<FVRClientAuthThrowRep> & PendingThrows, TFunctionRef<void(const TArray<FVRClientAuthThrowRep> &)> SendRPC);
+
 	void UpdateBuckets(float DeltaTime)
 	{
 		TArray<uint32> BucketsToRemove;
@@ -140,6 +287,9 @@ public:
 			ReplicationBuckets.Remove(Key);
 		}
 
+		if (PendingClientAuthThrows.Num() > 0)
+			FlushClientAuthThrows();
+
 		if (ReplicationBuckets.Num() < 1)
 			bNeedsUpdate = false;
 	}
@@ -359,104 +509,21 @@ public:
 };
 #endif
 
-USTRUCT()
-struct VREXPANSIONPLUGIN_API FRepMovementVR : public FRepMovement
+// Runtime state for an in progress client auth throw, only allocated while an object is actually being thrown
+struct VREXPANSIONPLUGIN_API FVRClientAuthThrowingState
 {
-	GENERATED_USTRUCT_BODY()
-public:
-
-		FRepMovementVR() : FRepMovement()
-		{
-			LocationQuantizationLevel = EVectorQuantization::RoundTwoDecimals;
-			VelocityQuantizationLevel = EVectorQuantization::RoundTwoDecimals;
-			RotationQuantizationLevel = ERotatorQuantization::ShortComponents;
-		}
-
-		FRepMovementVR(FRepMovement & other) : FRepMovement()
-		{
-			FRepMovementVR();
-
-			LinearVelocity = other.LinearVelocity;
-			AngularVelocity = other.AngularVelocity;
-			Location = other.Location;
-			Rotation = other.Rotation;
-			bSimulatedPhysicSleep = other.bSimulatedPhysicSleep;
-			bRepPhysics = other.bRepPhysics;
-		}
-		
-		void CopyTo(FRepMovement &other) const
-		{
-			other.LinearVelocity = LinearVelocity;
-			other.AngularVelocity = AngularVelocity;
-			other.Location = Location;
-			other.Rotation = Rotation;
-			other.bSimulatedPhysicSleep = bSimulatedPhysicSleep;
-			other.bRepPhysics = bRepPhysics;
-		}
-
-		bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
-		{
-			return FRepMovement::NetSerialize(Ar, Map, bOutSuccess);
-		}
-
-		bool GatherActorsMovement(AActor * OwningActor)
-		{
-			//if (/*bReplicateMovement || (RootComponent && RootComponent->GetAttachParent())*/)
-			{
-				UPrimitiveComponent* RootPrimComp = Cast<UPrimitiveComponent>(OwningActor->GetRootComponent());
-				if (RootPrimComp && RootPrimComp->IsSimulatingPhysics())
-				{
-					FRigidBodyState RBState;
-					RootPrimComp->GetRigidBodyState(RBState);
-
-					FillFrom(RBState, OwningActor);
-					// Don't replicate movement if we're welded to another parent actor.
-					// Their replication will affect our position indirectly since we are attached.
-					bRepPhysics = !RootPrimComp->IsWelded();
-				}
-				else if (RootPrimComp != nullptr)
-				{
-					// If we are attached, don't replicate absolute position, use AttachmentReplication instead.
-					if (RootPrimComp->GetAttachParent() != nullptr)
-					{
-						return false; // We don't handle attachment rep
-
-					}
-					else
-					{
-						Location = FRepMovement::RebaseOntoZeroOrigin(RootPrimComp->GetComponentLocation(), OwningActor);
-						Rotation = RootPrimComp->GetComponentRotation();
-						LinearVelocity = OwningActor->GetVelocity();
-						AngularVelocity = FVector::ZeroVector;
-					}
-
-					bRepPhysics = false;
-				}
-			}
-
-			/*if (const UWorld* World = GetOwningWorld())
-			{
-				if (APlayerController* PlayerController = World->GetFirstPlayerController())
-				{
-					if (APlayerState* PlayerState = PlayerController->PlayerState)
-					{
-						CurrentPing = PlayerState->ExactPing;
-					}
-				}
-			}*/
-
-			return true;
-		}
-};
+	FTransform LastActorTransform;
+	float TimeAtInitialThrow;
+	float CeaseBlockingAtTime;
+	bool bWaitingToCease;
 
-template<>
-struct TStructOpsTypeTraits<FRepMovementVR> : public TStructOpsTypeTraitsBase2<FRepMovementVR>
-{
-	enum
+	FVRClientAuthThrowingState() :
+		LastActorTransform(FTransform::Identity),
+		TimeAtInitialThrow(0.0f),
+		CeaseBlockingAtTime(0.0f),
+		bWaitingToCease(false)
 	{
-		WithNetSerializer = true,
-		WithNetSharedSerialization = true,
-	};
+	}
 };
 
 USTRUCT(BlueprintType)
@@ -473,18 +540,32 @@ public:
 	UPROPERTY(EditAnywhere, NotReplicated, BlueprintReadOnly, Category = "VRReplication", meta = (ClampMin = "0", UIMin = "0", ClampMax = "100", UIMax = "100"))
 		int32 UpdateRate;
 
-	FTimerHandle ResetReplicationHandle;
-	FTransform LastActorTransform;
-	float TimeAtInitialThrow;
 	bool bIsCurrentlyClientAuth;
+	TUniquePtr<FVRClientAuthThrowingState> ThrowingState;
+
+	// Last controller to grip the object, used by the server to only accept throw updates from whoever threw it
+	TWeakObjectPtr<UGripMotionControllerComponent> LastHoldingController;
 
 	FVRClientAuthReplicationData() :
 		bUseClientAuthThrowing(false),
 		UpdateRate(30),
-		LastActorTransform(FTransform::Identity),
-		TimeAtInitialThrow(0.0f),
 		bIsCurrentlyClientAuth(false)
 	{
 
 	}
+
+	// Only the settings are copied, the throwing state belongs to the instance that is being thrown
+	FVRClientAuthReplicationData(const FVRClientAuthReplicationData & Other) :
+		bUseClientAuthThrowing(Other.bUseClientAuthThrowing),
+		UpdateRate(Other.UpdateRate),
+		bIsCurrentlyClientAuth(false)
+	{
+	}
+
+	FVRClientAuthReplicationData & operator=(const FVRClientAuthReplicationData & Other)
+	{
+		bUseClientAuthThrowing = Other.bUseClientAuthThrowing;
+		UpdateRate = Other.UpdateRate;
+		return *this;
+	}
 };
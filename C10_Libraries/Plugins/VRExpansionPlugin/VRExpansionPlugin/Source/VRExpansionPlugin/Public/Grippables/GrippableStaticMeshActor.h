@@ -72,6 +72,8 @@ public:
 
 	// From IVRReplicationInterface
 	virtual bool PollReplicationEvent(float DeltaTime) override;
+	virtual void ApplyClientAuthReplication(const FRepMovementVR & newMovement) override;
+	virtual bool IsClientAuthThrownBy(AController * SendingController) const override;
 
 	UFUNCTION(Category = "Networking")
 		void CeaseReplicationBlocking();
@@ -114,6 +114,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonComponent")
 	float DepressSpeed;
 
+	// Snaps the button to rest and stops ticking once settled or out of time instead of relying on exact convergence, can also ignore overlaps with no hand nearby
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonComponent")
+	FBPVRInteractibleSleepSettings SleepSettings;
+
+	// Time spent returning to rest, for the sleep policy
+	float SettleTime;
+
 	// Distance that the button depresses
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonComponent")
 	float DepressDistance;
@@ -150,6 +157,22 @@ public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
 		bool bReplicateMovement;
 
+	// When replicating movement, sends the button depth as a single 16 bit value instead of the full relative transform
+	// The transform is rebuilt on the client from the InitialRelativeTransform
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface|Replication")
+		bool bReplicateQuantizedState;
+
+	// The button depth packed into -DepressDistance - 0
+	UPROPERTY(ReplicatedUsing = OnRep_QuantizedButtonDepth)
+		uint16 QuantizedButtonDepth;
+
+	UFUNCTION()
+		virtual void OnRep_QuantizedButtonDepth()
+	{
+		float NewDepth = UVRInteractibleFunctionLibrary::DequantizeInteractibleValue(QuantizedButtonDepth, -DepressDistance, 0.0f);
+		this->SetRelativeLocation(InitialRelativeTransform.TransformPosition(SetAxisValue(NewDepth)), false);
+	}
+
 	virtual void PreReplication(IRepChangedPropertyTracker & ChangedPropertyTracker) override;
 
 	// Resetting the initial transform here so that it comes in prior to BeginPlay and save loading.
@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "VRInteractibleFunctionLibrary.h"
+#include "Interactibles/VRButtonComponent.h"
+#include "VRButtonPanelComponent.generated.h"
+
+/** Delegate for notification when a panel button state changes. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FVRButtonPanelStateChangedSignature, int32, ButtonIndex, bool, ButtonState, AActor *, InteractingActor, UPrimitiveComponent *, InteractingComponent);
+
+/** Delegate for notification when a panel button begins or ends an interaction. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FVRButtonPanelInteractionSignature, int32, ButtonIndex, AActor *, InteractingActor, UPrimitiveComponent *, InteractingComponent);
+
+// A single logical button on a button panel
+USTRUCT(BlueprintType, Category = "VRExpansionLibrary")
+struct VREXPANSIONPLUGIN_API FVRPanelButton
+{
+	GENERATED_BODY()
+public:
+
+	// Resting transform of the button relative to the panel
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRPanelButton")
+		FTransform RelativeTransform;
+
+	// Half extents of the press volume in the buttons local space, should cover the depress distance on the button axis
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRPanelButton")
+		FVector BoxExtent;
+
+	// Type of button this is
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRPanelButton")
+		EVRButtonType ButtonType;
+
+	// Current state of the button, writable to set initial value
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRPanelButton")
+		bool bButtonState;
+
+	// Whether the button is enabled or not (can be interacted with)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRPanelButton")
+		bool bIsEnabled;
+
+	FVRPanelButton() :
+		RelativeTransform(FTransform::Identity),
+		BoxExtent(2.5f, 2.5f, 5.0f),
+		ButtonType(EVRButtonType::Btn_Toggle_Return),
+		bButtonState(false),
+		bIsEnabled(true)
+	{}
+};
+
+/**
+* A bank of buttons that share a single component, each button is an instance of the static mesh.
+* Instead of overlap events it tests the registered fingertip components against every button once per tick.
+* Not replicated, the button states are meant to be driven locally like the default button component.
+*/
+UCLASS(Blueprintable, meta = (BlueprintSpawnableComponent), ClassGroup = (VRExpansionPlugin))
+class VREXPANSIONPLUGIN_API UVRButtonPanelComponent : public UInstancedStaticMeshComponent
+{
+	GENERATED_BODY()
+
+public:
+	UVRButtonPanelComponent(const FObjectInitializer& ObjectInitializer);
+
+
+	~UVRButtonPanelComponent();
+
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
+	virtual void BeginPlay() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	// The buttons on this panel, call RebuildButtons after changing them at runtime
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonPanelComponent")
+		TArray<FVRPanelButton> Buttons;
+
+	// Speed that the buttons de-press when no longer interacted with
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonPanelComponent")
+		float DepressSpeed;
+
+	// Distance that the buttons depress
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonPanelComponent")
+		float DepressDistance;
+
+	// Negative on this axis is the depress direction
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonPanelComponent")
+		EVRInteractibleAxis ButtonAxis;
+
+	// Depth at which the buttons engage (switch)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonPanelComponent")
+		float ButtonEngageDepth;
+
+	// Minimum time before a button can be switched again
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRButtonPanelComponent")
+		float MinTimeBetweenEngaging;
+
+	// On a button state changing, keep in mind that InteractingActor can be invalid if manually setting the state
+	UPROPERTY(BlueprintAssignable, Category = "VRButtonPanelComponent")
+		FVRButtonPanelStateChangedSignature OnButtonStateChanged;
+
+	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "Button State Changed"))
+		void ReceiveButtonStateChanged(int32 ButtonIndex, bool bCurButtonState, AActor * LastInteractingActor, UPrimitiveComponent * InteractingComponent);
+
+	// On a button beginning interaction
+	UPROPERTY(BlueprintAssignable, Category = "VRButtonPanelComponent")
+		FVRButtonPanelInteractionSignature OnButtonBeginInteraction;
+
+	// On a button ending interaction, called once it has returned to its resting position
+	UPROPERTY(BlueprintAssignable, Category = "VRButtonPanelComponent")
+		FVRButtonPanelInteractionSignature OnButtonEndInteraction;
+
+	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "Button Started Interaction"))
+		void ReceiveButtonBeginInteraction(int32 ButtonIndex, AActor * InteractingActor, UPrimitiveComponent * InteractingComponent);
+
+	UFUNCTION(BlueprintImplementableEvent, meta = (DisplayName = "Button Ended Interaction"))
+		void ReceiveButtonEndInteraction(int32 ButtonIndex, AActor * LastInteractingActor, UPrimitiveComponent * LastInteractingComponent);
+
+	// Adds a component to probe the buttons with, its location is used as the fingertip point
+	UFUNCTION(BlueprintCallable, Category = "VRButtonPanelComponent")
+		void RegisterFingertip(UPrimitiveComponent * FingertipComponent);
+
+	UFUNCTION(BlueprintCallable, Category = "VRButtonPanelComponent")
+		void UnregisterFingertip(UPrimitiveComponent * FingertipComponent);
+
+	// Re-creates the button instances and cached bounds from the Buttons array
+	UFUNCTION(BlueprintCallable, Category = "VRButtonPanelComponent")
+		void RebuildButtons();
+
+	// Sets a buttons state outside of interaction, bSnapIntoPosition is for Toggle_Stay mode, it will lerp into the new position if this is false
+	UFUNCTION(BlueprintCallable, Category = "VRButtonPanelComponent")
+		void SetButtonState(int32 ButtonIndex, bool bNewButtonState, bool bCallButtonChangedEvent = true, bool bSnapIntoPosition = false);
+
+	UFUNCTION(BlueprintPure, Category = "VRButtonPanelComponent")
+		bool GetButtonState(int32 ButtonIndex) const;
+
+	UFUNCTION(BlueprintPure, Category = "VRButtonPanelComponent")
+		bool IsButtonInUse(int32 ButtonIndex) const;
+
+	// Times the moved instances were sent to the renderer, for profiling
+	int32 NumRenderStateUpdates;
+
+protected:
+
+	// Runtime state for a single button, kept out of the editable struct
+	struct FPanelButtonState
+	{
+		FTransform InverseRelativeTransform;
+		TWeakObjectPtr<UPrimitiveComponent> InteractingComponent;
+		TWeakObjectPtr<UPrimitiveComponent> LastInteractingComponent;
+		float InitialFingertipDepth;
+		float InitialButtonDepth;
+		float CurrentDepth;
+		float LastToggleTime;
+		bool bToggledThisTouch;
+		bool bIsActive;
+
+		FPanelButtonState() :
+			InverseRelativeTransform(FTransform::Identity),
+			InitialFingertipDepth(0.0f),
+			InitialButtonDepth(0.0f),
+			CurrentDepth(0.0f),
+			LastToggleTime(0.0f),
+			bToggledThisTouch(false),
+			bIsActive(false)
+		{}
+	};
+
+	TArray<FPanelButtonState> ButtonStates;
+	bool bHasActiveButtons;
+	bool bInstancesDirty;
+
+	// Panel space bounds of each button as separate arrays so the broad phase stays a tight loop
+	TArray<float> BoundsMinX, BoundsMinY, BoundsMinZ;
+	TArray<float> BoundsMaxX, BoundsMaxY, BoundsMaxZ;
+	FBox PanelBounds;
+
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Fingertips;
+	TArray<FVector> FingertipLocations;
+
+	void BeginButtonInteraction(int32 ButtonIndex, int32 FingertipIndex, const FVector & ButtonSpaceLocation);
+	void SetButtonDepth(int32 ButtonIndex, float NewDepth);
+	void FlushInstanceUpdates();
+	float GetTargetDepth(int32 ButtonIndex) const;
+	void ChangeButtonState(int32 ButtonIndex, bool bNewButtonState, bool bCallButtonChangedEvent);
+	AActor * GetInteractingActor(UPrimitiveComponent * InteractingComponent) const;
+
+	inline float GetAxisValue(const FVector & CheckLocation) const
+	{
+		return UVRInteractibleFunctionLibrary::GetAxisValue(ButtonAxis, CheckLocation);
+	}
+
+	inline FVector SetAxisValue(float SetValue) const
+	{
+		return UVRInteractibleFunctionLibrary::SetAxisValueVec(ButtonAxis, SetValue);
+	}
+};
@@ -83,6 +83,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRDialComponent")
 	EVRInteractibleAxis DialRotationAxis;
 
+	// If greater than zero the dial only updates its transform when the visible angle moves this many degrees (or hits a snap angle)
+	// Smaller changes are still accumulated into the dial angle and events, this saves child transform updates on slow turns
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRDialComponent", meta = (ClampMin = "0.0", ClampMax = "45.0", UIMin = "0.0", UIMax = "45.0"))
+	float DialRotationUpdateTolerance;
+
 	// If true then the dial will directly sample the hands rotation instead of using its movement around it.
 	// This is good for roll specific dials but is fairly bad elsewhere.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRDialComponent")
@@ -105,6 +110,16 @@ public:
 	float CurRotBackEnd;
 	FRotator LastRotation;
 	float LastSnapAngle;
+	float LastAppliedDialAngle;
+
+	// Times the dial has set its relative rotation, for profiling
+	int32 NumDialTransformUpdates;
+
+	// Shared by Add and SetDialAngle, clamps and snaps the backend angle and updates the transform
+	void UpdateDialAngle(float DialAngleDelta, bool bCallEvents, bool bForceTransformUpdate);
+
+	// Sets the relative rotation to the angle if it is outside of the update tolerance or forced
+	void UpdateDialRotation(float VisibleAngle, bool bForceUpdate);
 
 	// Should be called after the dial is moved post begin play
 	UFUNCTION(BlueprintCallable, Category = "VRLeverComponent")
@@ -145,6 +160,21 @@ public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
 		bool bReplicateMovement;
 
+	// When replicating movement, sends the dial angle as a single 16 bit value instead of the full relative transform
+	// The transform is rebuilt on the client from the InitialRelativeTransform
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface|Replication")
+		bool bReplicateQuantizedState;
+
+	// The dial angle packed into 0 - 360 degrees
+	UPROPERTY(ReplicatedUsing = OnRep_QuantizedDialAngle)
+		uint16 QuantizedDialAngle;
+
+	UFUNCTION()
+	virtual void OnRep_QuantizedDialAngle()
+	{
+		SetDialAngle(UVRInteractibleFunctionLibrary::DequantizeInteractibleValue(QuantizedDialAngle, 0.0f, 360.0f));
+	}
+
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
 
@@ -55,6 +55,44 @@ public:
 	FTransform ReversedRelativeTransform;
 };
 
+// Optional sleep policy for interactibles that keep ticking after release while settling back to rest
+// Distances are in the interactibles own units, cm for buttons, degrees for levers and progress per frame for slider momentum
+USTRUCT(BlueprintType, Category = "VRExpansionLibrary")
+struct VREXPANSIONPLUGIN_API FBPVRInteractibleSleepSettings
+{
+	GENERATED_BODY()
+public:
+
+	// If true the interactible stops ticking once within the settle tolerance, or once the max settle time has passed
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SleepSettings")
+	bool bUseSleepPolicy;
+
+	// Distance from rest that counts as settled, the interactible snaps to rest when within it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SleepSettings", meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float SettleTolerance;
+
+	// Seconds that the interactible is allowed to settle for before it is put to sleep where it is, 0 is no limit
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SleepSettings", meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float MaxSettleTime;
+
+	// If true overlaps only wake the interactible while a motion controller is within HandWakeRange, and are let go of once none is
+	// Keeps props resting on or knocked into a button from holding it awake. Levers and sliders only wake from grips so they don't use this
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SleepSettings")
+	bool bWakeOnlyNearHands;
+
+	// Distance from the interactible that a motion controller has to be within for bWakeOnlyNearHands
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SleepSettings", meta = (ClampMin = "0.0", UIMin = "0.0"))
+	float HandWakeRange;
+
+	FBPVRInteractibleSleepSettings() :
+		bUseSleepPolicy(false),
+		SettleTolerance(0.01f),
+		MaxSettleTime(0.0f),
+		bWakeOnlyNearHands(false),
+		HandWakeRange(30.0f)
+	{}
+};
+
 UCLASS()
 class VREXPANSIONPLUGIN_API UVRInteractibleFunctionLibrary : public UBlueprintFunctionLibrary
 {
@@ -182,6 +220,22 @@ public:
 		return vec;
 	}
 
+	// Packs a value in the given range into 16 bits, used by the interactibles quantized state replication
+	static uint16 QuantizeInteractibleValue(float Value, float MinValue, float MaxValue)
+	{
+		if (MaxValue <= MinValue)
+			return 0;
+
+		float Alpha = FMath::Clamp((Value - MinValue) / (MaxValue - MinValue), 0.0f, 1.0f);
+		return (uint16)FMath::RoundToInt(Alpha * (float)MAX_uint16);
+	}
+
+	// Unpacks a value that was packed with QuantizeInteractibleValue, error is (MaxValue - MinValue) / 65535 at most
+	static float DequantizeInteractibleValue(uint16 QuantizedValue, float MinValue, float MaxValue)
+	{
+		return FMath::Lerp(MinValue, MaxValue, (float)QuantizedValue / (float)MAX_uint16);
+	}
+
 	// Get current parent transform
 	UFUNCTION(BlueprintPure, Category = "VRInteractibleFunctions", meta = (bIgnoreSelf = "true"))
 	static FTransform Interactible_GetCurrentParentTransform(USceneComponent * SceneComponentToCheck)
@@ -291,6 +345,38 @@ public:
 		return ValueToSnap;
 	}
 
+	// Returns true if the sleep policy considers this distance from rest as settled
+	static bool Interactible_IsWithinSettleTolerance(const FBPVRInteractibleSleepSettings & SleepSettings, float DistanceFromRest)
+	{
+		return SleepSettings.bUseSleepPolicy && FMath::Abs(DistanceFromRest) <= SleepSettings.SettleTolerance;
+	}
+
+	// Accumulates the settle time, returns true if the sleep policy has run out of time
+	static bool Interactible_UpdateSettleTime(const FBPVRInteractibleSleepSettings & SleepSettings, float DeltaTime, float & SettleTime)
+	{
+		if (!SleepSettings.bUseSleepPolicy || SleepSettings.MaxSettleTime <= 0.0f)
+			return false;
+
+		SettleTime += DeltaTime;
+		return SettleTime >= SleepSettings.MaxSettleTime;
+	}
+
+	// Motion controllers register themselves on begin play so interactibles can check for nearby hands without an overlap query
+	static void Interactible_RegisterHand(USceneComponent * Hand);
+	static void Interactible_UnregisterHand(USceneComponent * Hand);
+
+	// Returns true if a registered hand in the same world is within Range of the interactible
+	static bool Interactible_IsHandWithinRange(const USceneComponent * Interactible, float Range);
+
+	// Returns true if the sleep policy lets an overlap wake the interactible or keep it awake
+	static bool Interactible_CanWakeFromOverlap(const FBPVRInteractibleSleepSettings & SleepSettings, const USceneComponent * Interactible)
+	{
+		if (!SleepSettings.bUseSleepPolicy || !SleepSettings.bWakeOnlyNearHands)
+			return true;
+
+		return Interactible_IsHandWithinRange(Interactible, SleepSettings.HandWakeRange);
+	}
+
 };	
 
 
@@ -148,6 +148,13 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "VRLeverComponent")
 		bool bIsLerping;
 
+	// Stops the lerp / momentum once settled or out of time instead of relying on exact convergence
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRLeverComponent|Lerping")
+		FBPVRInteractibleSleepSettings SleepSettings;
+
+	// Time spent lerping since release, for the sleep policy
+	float SettleTime;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRLeverComponent")
 		int GripPriority;
 
@@ -214,6 +221,21 @@ public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
 		bool bReplicateMovement;
 
+	// When replicating movement, sends the lever angle as a single 16 bit value instead of the full relative transform
+	// The transform is rebuilt on the client from the InitialRelativeTransform, only used with the single axis modes (X/Y/Z)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface|Replication")
+		bool bReplicateQuantizedState;
+
+	// The lever angle packed into -180 - 180 degrees
+	UPROPERTY(ReplicatedUsing = OnRep_QuantizedLeverAngle)
+		uint16 QuantizedLeverAngle;
+
+	UFUNCTION()
+	virtual void OnRep_QuantizedLeverAngle();
+
+	// Returns true if the current settings allow the lever to replicate as a single value
+	bool CanReplicateQuantizedState() const;
+
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
 
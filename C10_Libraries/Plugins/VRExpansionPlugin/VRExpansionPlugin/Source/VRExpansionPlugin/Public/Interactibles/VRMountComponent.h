@@ -54,6 +54,17 @@ public:
 	float InitialGripRot;
 	FQuat qRotAtGrab;
 
+	// Cached at grip so the per frame solve stays in quaternions
+	FQuat InitialRelativeQuat;
+	float InitialGripRadius;
+
+	// Same as FRotator(Pitch, Yaw, Twist) of the given rotation without the euler round trip
+	FORCEINLINE static FQuat GetYawPitchTwistQuat(const FQuat & MountQuat, float Twist)
+	{
+		// Roll doesn't change the forward vector so it holds the yaw and pitch on its own
+		return MountQuat.GetForwardVector().ToOrientationQuat() * FQuat(FVector::ForwardVector, -FMath::DegreesToRadians(Twist));
+	}
+
 	// If the mount is swirling around a 90 degree pitch increase this number by 0.1 steps. 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRMountComponent")
 		float FlipingZone;
@@ -116,6 +127,12 @@ public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
 		bool bReplicateMovement;
 
+	// When replicating movement, only sends the relative rotation since the mount never translates or scales
+	// Not the same as bReplicateQuantizedState on the other interactibles, the mount has pitch, yaw and a twist roll so there isn't a single value to pack
+	// RelativeRotation is still sent as is, already 16 bit shorts
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface|Replication")
+		bool bReplicateRotationOnly;
+
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
 
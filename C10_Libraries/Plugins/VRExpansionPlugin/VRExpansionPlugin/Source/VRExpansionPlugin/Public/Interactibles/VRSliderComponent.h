@@ -95,6 +95,13 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "VRSliderComponent")
 		bool bIsLerping;
 
+	// Stops the momentum once settled or out of time instead of relying on it reaching zero
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRSliderComponent|Momentum Settings")
+		FBPVRInteractibleSleepSettings SleepSettings;
+
+	// Time spent lerping since release, for the sleep policy
+	float SettleTime;
+
 	// For momentum retention
 	float MomentumAtDrop;
 	float LastSliderProgress;
@@ -225,6 +232,24 @@ public:
 	UPROPERTY(EditAnywhere, Replicated, BlueprintReadWrite, Category = "VRGripInterface|Replication")
 		bool bReplicateMovement;
 
+	// When replicating movement, sends the slider progress as a single 16 bit value instead of the full relative transform
+	// The transform is rebuilt on the client from the InitialRelativeTransform, only used with spline and single axis sliders
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRGripInterface|Replication")
+		bool bReplicateQuantizedState;
+
+	// The slider progress packed into 0 - 1
+	UPROPERTY(ReplicatedUsing = OnRep_QuantizedSliderProgress)
+		uint16 QuantizedSliderProgress;
+
+	UFUNCTION()
+	virtual void OnRep_QuantizedSliderProgress()
+	{
+		SetSliderProgress(UVRInteractibleFunctionLibrary::DequantizeInteractibleValue(QuantizedSliderProgress, 0.0f, 1.0f));
+	}
+
+	// Returns true if the current settings allow the slider to replicate as a single value
+	bool CanReplicateQuantizedState() const;
+
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	virtual void BeginPlay() override;
 
@@ -33,11 +33,27 @@ struct FVRLogMessage
 	FName Category;
 	FName Style;
 
+	// Display text for the line, built on first draw and reused on every redraw after
+	FText CachedDisplayText;
+	bool bHasCachedDisplayText;
+
+	const FText& GetDisplayText()
+	{
+		if (!bHasCachedDisplayText)
+		{
+			CachedDisplayText = FText::FromString(*Message);
+			bHasCachedDisplayText = true;
+		}
+
+		return CachedDisplayText;
+	}
+
 	FVRLogMessage(const TSharedRef<FString>& NewMessage, FName NewCategory, FName NewStyle = NAME_None)
 		: Message(NewMessage)
 		, Verbosity(ELogVerbosity::Log)
 		, Category(NewCategory)
 		, Style(NewStyle)
+		, bHasCachedDisplayText(false)
 	{
 	}
 
@@ -46,6 +62,7 @@ struct FVRLogMessage
 		, Verbosity(NewVerbosity)
 		, Category(NewCategory)
 		, Style(NewStyle)
+		, bHasCachedDisplayText(false)
 	{
 	}
 };
@@ -239,4 +256,20 @@ public:
 	void DrawConsole(bool bLowerHalfOnly, UCanvas* Canvas);
 	void DrawOutputLog(bool bUpperHalfOnly, UCanvas* Canvas, float ScrollOffset);
 
+	// Returns the message index (from the end of the log) that the output log will start drawing at for this scroll offset
+	int32 GetOutputLogScrollPos(float ScrollOffset) const;
+
+	// Canvas items drawn by the output log since creation, for profiling
+	int32 OutputLogDrawItemCount;
+
+private:
+
+	// State of the last output log draw, used to skip redraws when neither the content nor the scroll changed
+	TWeakObjectPtr<UTextureRenderTarget2D> LastDrawnRenderTarget;
+	int32 LastDrawnScrollPos;
+
+	// Cached line height for the font, measuring is done once instead of every draw
+	TWeakObjectPtr<UFont> CachedLineFont;
+	float CachedLineHeight;
+
 };
\ No newline at end of file
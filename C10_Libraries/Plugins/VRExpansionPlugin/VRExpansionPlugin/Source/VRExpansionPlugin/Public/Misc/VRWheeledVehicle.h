@@ -23,6 +23,51 @@ class VREXPANSIONPLUGIN_API AVRWheeledVehicle : public AWheeledVehicle
 {
 	GENERATED_BODY()
 
+public:
+
+	AVRWheeledVehicle(const FObjectInitializer& ObjectInitializer);
+
+	virtual void Tick(float DeltaSeconds) override;
+
+	// Sends the driver inputs as a single packed 32 bit unreliable RPC instead of the movement components reliable float RPC
+	// Use with SetPackedVehicleInputs from the seated VR pawn instead of SetOverrideController on the client, the client applies the inputs locally so it predicts the chassis
+	// Chassis corrections still come from the standard replicated movement.
+	// Needs UVRWheeledVehicleMovementComponent4W as the vehicle movement class, other movement components only take the input when locally controlled
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRWheeledVehicle|Input")
+		bool bUsePackedInputUplink;
+
+	// How often to re-send unchanged inputs, covers for dropped packets since the uplink is unreliable
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRWheeledVehicle|Input", meta = (ClampMin = "0.0", UIMin = "0.0"))
+		float PackedInputResendInterval;
+
+	// Sets the driver inputs when using the packed uplink, call every frame from the driving pawn
+	UFUNCTION(BlueprintCallable, Category = "VRWheeledVehicle|Input")
+		void SetPackedVehicleInputs(float Steering, float Throttle, float Brake, bool bHandbrake);
+
+	// Stops applying the packed inputs (driver left the seat)
+	UFUNCTION(BlueprintCallable, Category = "VRWheeledVehicle|Input")
+		void ClearPackedVehicleInputs();
+
+	UFUNCTION(Unreliable, Server, WithValidation)
+		void ServerSendPackedVehicleInput(uint32 PackedInput);
+
+	// Packs steering (9 bits), throttle (9 bits), brake (8 bits), handbrake (1 bit) and gear (5 bits) into 32 bits
+	static uint32 PackVehicleInput(float Steering, float Throttle, float Brake, bool bHandbrake, int32 Gear);
+	static void UnpackVehicleInput(uint32 PackedInput, float & Steering, float & Throttle, float & Brake, bool & bHandbrake, int32 & Gear);
+
+	// If the client should send its packed input this tick, changed inputs go out right away and unchanged ones every ResendInterval
+	static bool ShouldSendPackedInput(uint32 PackedInput, uint32 LastSentPackedInput, float TimeSinceLastSend, float ResendInterval);
+
+protected:
+
+	// Pushes the packed input into the movement component the same way the engines server update does
+	void ApplyPackedVehicleInput(uint32 PackedInput);
+
+	uint32 LocalPackedInput;
+	uint32 LastSentPackedInput;
+	float LastPackedInputSendTime;
+	bool bHasLocalPackedInput;
+
 public:
 
 	/** Call this function to detach safely pawn from its controller, knowing that we will be destroyed soon.	 */
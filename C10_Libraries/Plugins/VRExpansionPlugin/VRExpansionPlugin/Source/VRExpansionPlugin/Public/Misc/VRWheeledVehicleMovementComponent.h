@@ -0,0 +1,22 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "WheeledVehicleMovementComponent4W.h"
+#include "VRWheeledVehicleMovementComponent.generated.h"
+
+/**
+* Four wheel vehicle movement that lets AVRWheeledVehicle's packed input uplink set the driver input directly.
+* The engine only reads inputs from a locally controlled vehicles own controller, or from the replicated state that its protected ServerUpdateState sets.
+* Use this as the vehicle movement class when the vehicle is driven through SetPackedVehicleInputs.
+*/
+UCLASS(ClassGroup = (VRExpansionPlugin), meta = (BlueprintSpawnableComponent))
+class VREXPANSIONPLUGIN_API UVRWheeledVehicleMovementComponent4W : public UWheeledVehicleMovementComponent4W
+{
+	GENERATED_BODY()
+
+public:
+
+	// Sets the driver input the same way the engines ServerUpdateState does, it is then picked up by UpdateState on both the server and the predicting client
+	void SetVehicleInputState(float InSteeringInput, float InThrottleInput, float InBrakeInput, float InHandbrakeInput, int32 InCurrentGear);
+};
@@ -66,6 +66,20 @@ public:
 	UPROPERTY(BlueprintReadOnly, Transient, Category = VRMovement)
 		UCameraComponent * VRCameraComponent;
 
+	// Typed owner, filled in with the updated component so tick doesn't have to cast
+	UPROPERTY(Transient)
+		AVRSimpleCharacter * OwningSimpleCharacter;
+
+	// Inputs the owners OffsetComponentToWorld was last generated from, it is only regenerated when one changes
+	FVector LastOffsetActorLocation;
+	FVector LastOffsetActorScale;
+	FQuat LastOffsetCameraRotation;
+	bool bHasGeneratedOffsetToWorld;
+
+	// Transform pushes and offset regenerations made by the HMD follow in tick, for profiling
+	int32 NumTransformPushes;
+	int32 NumOffsetToWorldUpdates;
+
 	// Skips checking for the HMD location on tick, for 2D pawns when a headset is connected
 	UPROPERTY(BlueprintReadWrite, Category = VRMovement)
 		bool bSkipHMDChecks;
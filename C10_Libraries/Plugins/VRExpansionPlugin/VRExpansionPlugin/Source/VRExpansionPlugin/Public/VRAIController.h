@@ -9,14 +9,47 @@
 #include "VRAIController.generated.h"
 
 
+// A cached line of sight result from this controller to a target
+struct FVRLineOfSightCacheEntry
+{
+	FVector ViewPoint;
+	FVector TargetLocation;
+	float TimeStamp;
+	bool bAlternateChecks;
+	bool bHasLineOfSight;
+};
+
 UCLASS()
 class VREXPANSIONPLUGIN_API AVRAIController : public AAIController
 {
 	GENERATED_BODY()
 
 public:
+	AVRAIController(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
 	virtual FVector GetFocalPointOnActor(const AActor *Actor) const override;
 
+	// Re-uses line of sight results to the same target while neither end has moved much
+	// Saves the up to four traces per query when behavior trees / focus / EQS ask for the same target multiple times a frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRAIController|LineOfSight")
+		bool bUseLineOfSightCache;
+
+	// Maximum age in seconds of a cached line of sight result, 0 only re-uses results from the same frame time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRAIController|LineOfSight", meta = (ClampMin = "0.0", UIMin = "0.0"))
+		float LineOfSightCacheMaxAge;
+
+	// Distance the view point or the target can move before a cached result is thrown out
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRAIController|LineOfSight", meta = (ClampMin = "0.0", UIMin = "0.0"))
+		float LineOfSightCacheTolerance;
+
+	// Clears all of the cached line of sight results
+	UFUNCTION(BlueprintCallable, Category = "VRAIController|LineOfSight")
+		void ClearLineOfSightCache();
+
+	// Visibility traces run for LineOfSightTo and the queries answered from the cache, for profiling
+	mutable int32 NumLineOfSightTraces;
+	mutable int32 NumLineOfSightCacheHits;
+
 	/**
 	* Checks line to center and top of other actor
 	* @param Other is the actor whose visibility is being checked.
@@ -26,6 +59,13 @@ public:
 	*/
 	virtual bool LineOfSightTo(const AActor* Other, FVector ViewPoint = FVector(ForceInit), bool bAlternateChecks = false) const override;
 	//~ End AController Interface
+
+protected:
+
+	// Runs the actual traces for LineOfSightTo, ViewPoint must already be resolved
+	bool TraceLineOfSightTo(const AActor* Other, const FVector & ViewPoint, bool bAlternateChecks) const;
+
+	mutable TMap<TWeakObjectPtr<const AActor>, FVRLineOfSightCacheEntry> LineOfSightCache;
 };
 
 
@@ -5,6 +5,7 @@
 //#include "EngineMinimal.h"
 
 #include "PhysicsPublic.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #if WITH_PHYSX
 #include "PhysXPublic.h"
 #include "PhysXSupport.h"
@@ -15,6 +16,11 @@
 class UGripMotionControllerComponent;
 class UVRGripScriptBase;
 
+// Per frame timings for the plugins hot paths, off by default
+// Enable with -csvCategories=VRExpansion (works with -nullrhi and no HMD) and capture with csvprofile start / stop
+// The resulting CSV files can be diffed between builds with the engines CSVToSVG / PerfReportTool
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(VREXPANSIONPLUGIN_API, VRExpansion);
+
 
 // Custom movement modes for the characters
 UENUM(BlueprintType)
@@ -405,6 +405,74 @@ struct TStructOpsTypeTraits< FVRConditionalMoveRep2 > : public TStructOpsTypeTra
 	};
 };
 
+// Client correction that is relative to the location the client sent for the corrected move
+// Only used when the base hasn't changed from the clients, otherwise the full correction is sent
+USTRUCT()
+struct VREXPANSIONPLUGIN_API FVRCompactClientAdjustment
+{
+	GENERATED_USTRUCT_BODY()
+public:
+
+	// Server location minus the location the client reported for this timestamp
+	UPROPERTY(Transient)
+		FVector LocationOffset;
+
+	UPROPERTY(Transient)
+		FVector NewVelocity;
+
+	UPROPERTY(Transient)
+		uint16 NewYaw;
+
+	UPROPERTY(Transient)
+		uint8 ServerMovementMode;
+
+	FVRCompactClientAdjustment()
+	{
+		LocationOffset = FVector::ZeroVector;
+		NewVelocity = FVector::ZeroVector;
+		NewYaw = 0;
+		ServerMovementMode = 0;
+	}
+
+	/** Network serialization */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		bOutSuccess = true;
+
+		// Packed vectors scale their bit count with the magnitude, most corrections are small offsets
+		bOutSuccess &= SerializePackedVector<100, 30>(LocationOffset, Ar);
+
+		bool bHasVelocity = !NewVelocity.IsZero();
+		Ar.SerializeBits(&bHasVelocity, 1);
+
+		if (bHasVelocity)
+		{
+			bOutSuccess &= SerializePackedVector<10, 24>(NewVelocity, Ar);
+		}
+		else if (Ar.IsLoading())
+		{
+			NewVelocity = FVector::ZeroVector;
+		}
+
+		uint32 Yaw32 = NewYaw;
+		Ar.SerializeIntPacked(Yaw32);
+		NewYaw = (uint16)Yaw32;
+
+		Ar << ServerMovementMode;
+
+		return bOutSuccess;
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits< FVRCompactClientAdjustment > : public TStructOpsTypeTraitsBase2<FVRCompactClientAdjustment>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 /**
 * Helper to change mesh bone updates within a scope.
 * Example usage:
@@ -455,6 +523,15 @@ public:
 	FRotator VRCapsuleRotation;
 	FVRConditionalMoveRep ConditionalValues;
 
+	// What was actually sent to the server for this move, replays overwrite the saved location afterwards
+	// Compact corrections are relative to this
+	mutable FVector SentLocation;
+	mutable TWeakObjectPtr<UPrimitiveComponent> SentBase;
+	mutable FName SentBoneName;
+
+	// Set when a combined replay ran this move inside a larger step, its saved location is the end of the whole run
+	bool bSavedLocationFromCombinedReplay;
+
 	void Clear();
 	virtual void SetInitialPosition(ACharacter* C);
 
@@ -464,6 +541,9 @@ public:
 		LFDiff = FVector::ZeroVector;
 		VRCapsuleRotation = FRotator::ZeroRotator;
 		VRReplicatedMovementMode = EVRConjoinedMovementModes::C_MOVE_MAX;// _None;
+		SentLocation = FVector::ZeroVector;
+		SentBoneName = NAME_None;
+		bSavedLocationFromCombinedReplay = false;
 	}
 
 	virtual uint8 GetCompressedFlags() const override
@@ -68,6 +68,11 @@ public:
 		void ClientVeryShortAdjustPositionVR(float TimeStamp, FVector NewLoc, uint16 NewYaw, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode);
 	void ClientVeryShortAdjustPositionVR_Implementation(float TimeStamp, FVector NewLoc, uint16 NewYaw, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode);
 
+	/* Bandwidth saving version, location is an offset from what the client sent and the base is the clients own */
+	UFUNCTION(unreliable, client)
+		void ClientCompactAdjustPositionVR(float TimeStamp, FVRCompactClientAdjustment Adjustment);
+	void ClientCompactAdjustPositionVR_Implementation(float TimeStamp, FVRCompactClientAdjustment Adjustment);
+
 
 	/** Replicated function sent by client to server - contains client movement and view info. */
 	UFUNCTION(unreliable, server, WithValidation)
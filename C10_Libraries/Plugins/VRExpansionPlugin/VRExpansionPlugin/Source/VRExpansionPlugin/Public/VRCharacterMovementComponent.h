@@ -28,6 +28,33 @@ DECLARE_LOG_CATEGORY_EXTERN(LogVRCharacterMovement, Log, All);
 /** Shared pointer for easy memory management of FSavedMove_Character, for accumulating and replaying network moves. */
 //typedef TSharedPtr<class FSavedMove_Character> FSavedMovePtr;
 
+// Most server moves a character holds back for the budget before it stops queuing and runs them all
+#define VR_MAX_QUEUED_SERVER_MOVES 16
+
+// A ServerMoveVR held back on the server because the frames move budget was used up (vre.ServerMoveBudgetMS)
+struct VREXPANSIONPLUGIN_API FVRQueuedServerMove
+{
+	float TimeStamp;
+	FVector_NetQuantize10 InAccel;
+	FVector_NetQuantize100 ClientLoc;
+	FVector_NetQuantize100 CapsuleLoc;
+	FVRConditionalMoveRep ConditionalReps;
+	FVector_NetQuantize100 LFDiff;
+	uint16 CapsuleYaw;
+	uint8 CompressedMoveFlags;
+	FVRConditionalMoveRep2 MoveReps;
+	uint8 ClientMovementMode;
+
+	// MoveReps base is a raw pointer, this is what gets put back into it when the move runs
+	TWeakObjectPtr<UPrimitiveComponent> ClientMovementBase;
+
+	// A resent ServerMoveVROld, only uses TimeStamp, InAccel, CompressedMoveFlags and ConditionalReps
+	bool bIsOldMove = false;
+
+	// If the newer move can be run in place of both of them
+	bool CanCombineWith(const FVRQueuedServerMove& NewMove) const;
+};
+
 
 //=============================================================================
 /**
@@ -73,6 +100,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent", meta = (ClampMin = "0.01", UIMin = "0", ClampMax = "1.0", UIMax = "1"))
 	float WallRepulsionMultiplier;
 
+	// Horizontal distance the capsule can drift (HMD jitter) over the same static floor before FindFloor runs a new trace.
+	// The last floor is reused while within this range at the same height on the same base and movement mode, 0 disables it.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent", meta = (ClampMin = "0", UIMin = "0", ClampMax = "10.0", UIMax = "10"))
+	float FloorCacheTolerance;
+
 	/**
 	* Checks if new capsule size fits (no encroachment), and call CharacterOwner->OnStartCrouch() if successful.
 	* In general you should set bWantsToCrouch instead to have the crouch persist during movement, or just use the crouch functions on the owning Character.
@@ -113,6 +145,37 @@ public:
 
 	void PostPhysicsTickComponent(float DeltaTime, FCharacterMovementComponentPostPhysicsTickFunction& ThisTickFunction) override;
 	void SimulateMovement(float DeltaSeconds) override;
+
+	// If true then simulated proxies that are far from every local view, or haven't been rendered recently, stop predicting movement.
+	// They skip floor finds and sweeps and only take the replicated updates, which the network smoothing interpolates.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking")
+		bool bUseSimulatedProxyLOD;
+
+	// Distance from the closest local view past which a simulated proxy drops to the low LOD
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseSimulatedProxyLOD"))
+		float SimulatedProxyLODDistance;
+
+	// How much closer than SimulatedProxyLODDistance a low LOD proxy has to get before it returns to full simulation
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseSimulatedProxyLOD"))
+		float SimulatedProxyLODHysteresis;
+
+	// Time a proxy has to go un-rendered before it drops to the low LOD, 0 only uses the distance
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseSimulatedProxyLOD"))
+		float SimulatedProxyLODNotRenderedTime;
+
+	// Time a proxy stays in a LOD before it can switch again, keeps proxies at the edge of the view from flipping every frame as their rendered state changes
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking", meta = (ClampMin = "0", UIMin = "0", EditCondition = "bUseSimulatedProxyLOD"))
+		float SimulatedProxyLODMinDwellTime;
+
+	// True while this simulated proxy is running the low LOD
+	UPROPERTY(BlueprintReadOnly, Transient, Category = "VRCharacterMovementComponent|Networking")
+		bool bIsSimulatedProxyLowLOD;
+
+	// World time of the last LOD change
+	float SimulatedProxyLODChangeTime;
+
+	// Re-evaluates bIsSimulatedProxyLowLOD, returns true if the LOD changed
+	bool UpdateSimulatedProxyLOD();
 	void MoveSmooth(const FVector& InVelocity, const float DeltaSeconds, FStepDownResult* OutStepDownResult) override;
 	//void PerformMovement(float DeltaSeconds) override;
 
@@ -148,6 +211,39 @@ public:
 	virtual void ClientVeryShortAdjustPositionVR(float TimeStamp, FVector NewLoc, uint16 NewYaw, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode);
 	virtual void ClientVeryShortAdjustPositionVR_Implementation(float TimeStamp, FVector NewLoc, uint16 NewYaw, UPrimitiveComponent* NewBase, FName NewBaseBoneName, bool bHasBase, bool bBaseRelativePosition, uint8 ServerMovementMode);
 
+	/* Bandwidth saving version, sent as an offset from the clients reported location when the base is unchanged */
+	virtual void ClientCompactAdjustPositionVR(float TimeStamp, const FVRCompactClientAdjustment& Adjustment);
+	virtual void ClientCompactAdjustPositionVR_Implementation(float TimeStamp, const FVRCompactClientAdjustment& Adjustment);
+
+	// If true then corrections that keep the clients movement base are sent as a compact offset from the clients reported location
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking")
+		bool bUseCompactClientAdjustments;
+
+	// The location the client reported for the pending adjustment, in the same space as the adjustments NewLoc
+	// Set with the pending adjustment in ServerMoveHandleClientErrorVR and cleared once SendClientAdjustment consumes it
+	FVector PendingAdjustmentClientLoc;
+	bool bPendingAdjustmentCanBeCompact;
+
+	// Replays the un-acked saved moves after a correction, overridden to allow combining matching moves into single steps
+	virtual bool ClientUpdatePositionAfterServerUpdate() override;
+
+	// If true then runs of saved moves with matching inputs and no move actions are replayed as a single larger step after a correction
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking")
+		bool bCombineReplayedMoves;
+
+	// Longest step a combined replay is allowed to take, lower values are closer to the original simulation but cost more steps
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking", meta = (ClampMin = "0.01", UIMin = "0.01", ClampMax = "0.2", UIMax = "0.2", EditCondition = "bCombineReplayedMoves"))
+		float MaxCombinedReplayDeltaTime;
+
+	// Corrections that would leave the client within this distance of its own prediction (including velocity error over the pending moves)
+	// are applied as an offset to the current location and pending moves instead of replaying them, 0 always replays.
+	// Corrections for moves that were folded into a combined replay step always replay, their saved location isn't their own.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRCharacterMovementComponent|Networking", meta = (ClampMin = "0", UIMin = "0", ClampMax = "10.0", UIMax = "10"))
+		float ReplaySkipTolerance;
+
+	// Returns the offset to apply if the correction can skip the replay, see ReplaySkipTolerance
+	bool GetCorrectionOffsetWithoutReplay(const FNetworkPredictionData_Client_Character& ClientData, const FVector& NewLocation, const FVector& NewVelocity, UPrimitiveComponent* NewBase, uint8 ServerMovementMode, FVector& OutLocationOffset, FVector& OutVelocityOffset) const;
+
 
 
 	///////////////////////////
@@ -180,6 +276,22 @@ public:
 	virtual void ServerMoveVR(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
 	virtual void ServerMoveVR_Implementation(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
 	virtual bool ServerMoveVR_Validate(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
+
+	// Actually runs the old move, queued behind any waiting server moves so they stay in order
+	virtual void ProcessServerMoveVROld(float OldTimeStamp, FVector_NetQuantize10 OldAccel, uint8 OldMoveFlags, FVRConditionalMoveRep ConditionalReps);
+
+	// Actually runs the server move, ServerMoveVR_Implementation either calls this right away or queues the move when over the server move budget
+	virtual void ProcessServerMoveVR(float TimeStamp, FVector_NetQuantize10 InAccel, FVector_NetQuantize100 ClientLoc, FVector_NetQuantize100 CapsuleLoc, FVRConditionalMoveRep ConditionalReps, FVector_NetQuantize100 LFDiff, uint16 CapsuleYaw, uint8 CompressedMoveFlags, FVRConditionalMoveRep2 MoveReps, uint8 ClientMovementMode);
+
+	// Runs the moves queued by vre.ServerMoveBudgetMS, called at the start of the next tick
+	void ProcessQueuedServerMoves();
+
+	// Server moves (and old moves) waiting on the next tick, oldest first, capped at VR_MAX_QUEUED_SERVER_MOVES
+	TArray<FVRQueuedServerMove> QueuedServerMoves;
+
+	// Both drop any queued server moves
+	virtual void Deactivate() override;
+	virtual void OnUnregister() override;
 	
 	/** Replicated function sent by client to server - contains client movement and view info. ExLight version is used if there was no requested velocity or customVRInputVector or Accell*/
 	//UFUNCTION(unreliable, server, WithValidation)
@@ -245,6 +357,10 @@ public:
 	// Modify for correct location
 	virtual void ApplyRepulsionForce(float DeltaSeconds) override;
 
+	// Where an overlapping body is pushed from, solved against the capsule at the bodies height instead of tracing it
+	// Returns false if the body is left alone, bOutStopBody is set if it should be stopped instead of pushed
+	static bool GetRepulsionForceCenter(const FVector& CapsuleLocation, float CapsuleRadius, float CapsuleHalfHeight, const FVector& BodyLocation, const FVector& BodyVelocity, float DeltaSeconds, FVector& OutForceCenter, bool& bOutStopBody);
+
 	// Update BaseOffset to be zero
 	virtual void UpdateBasedMovement(float DeltaSeconds) override;
 
@@ -264,6 +380,20 @@ public:
 	// Had to force it within the function to use VRLocation instead.
 	virtual void FindFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult, bool bCanUseCachedLocation, const FHitResult* DownwardSweepResult = NULL) const;
 
+	// Floor cache for FindFloor, see FloorCacheTolerance
+	bool GetJitterCachedFloor(const FVector& CapsuleLocation, FFindFloorResult& OutFloorResult) const;
+	void StoreJitterCachedFloor(const FVector& CapsuleLocation, const FFindFloorResult& FloorResult) const;
+
+	mutable FFindFloorResult JitterCachedFloor;
+	mutable FVector JitterCachedFloorLocation;
+	mutable TWeakObjectPtr<UPrimitiveComponent> JitterCachedFloorBase;
+	mutable TEnumAsByte<EMovementMode> JitterCachedFloorMovementMode;
+	mutable bool bHasJitterCachedFloor;
+
+	// Floor results traced and reused from the cache since creation, for profiling
+	mutable int32 NumFloorTraces;
+	mutable int32 NumFloorCacheHits;
+
 	// Need to use actual capsule location for step up
 	bool StepUp(const FVector& GravDir, const FVector& Delta, const FHitResult &InHit, FStepDownResult* OutStepDownResult = NULL) override;
 
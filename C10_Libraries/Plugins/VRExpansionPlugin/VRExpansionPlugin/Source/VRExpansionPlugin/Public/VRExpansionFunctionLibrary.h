@@ -33,6 +33,25 @@ enum class EBPHMDWornState : uint8
 	NotWorn UMETA(DisplayName = "Not Worn"),
 };
 
+// HMD pose sampled once per frame, shared by all of the components that need the HMD location in the game thread
+struct VREXPANSIONPLUGIN_API FVRHMDPoseSnapshot
+{
+	uint64 FrameNumber;
+	double TimeStamp;
+	FQuat Orientation;
+	FVector Position;
+	bool bIsValid;
+
+	FVRHMDPoseSnapshot() :
+		FrameNumber(MAX_uint64),
+		TimeStamp(0.0),
+		Orientation(FQuat::Identity),
+		Position(FVector::ZeroVector),
+		bIsValid(false)
+	{
+	}
+};
+
 UCLASS()//, meta = (BlueprintSpawnableComponent))
 class VREXPANSIONPLUGIN_API UVRExpansionFunctionLibrary : public UBlueprintFunctionLibrary
 {
@@ -57,6 +76,14 @@ public:
 	UFUNCTION(BlueprintPure, Category = "VRExpansionFunctions", meta = (bIgnoreSelf = "true", DisplayName = "GetHMDPureYaw"))
 	static FRotator GetHMDPureYaw(FRotator HMDRotation);
 
+	// Returns the HMD pose for this frame, the tracking system is only queried by the first caller each frame.
+	// Sampled lazily instead of on begin frame as the XR systems update their poses at the start of the engine tick.
+	// Off of the game thread (late updates) this queries the tracking system directly.
+	static bool GetHMDPoseForFrame(FQuat & OutOrientation, FVector & OutPosition);
+
+	// Returns the current frames HMD snapshot, sampling it if it hasn't been yet
+	static const FVRHMDPoseSnapshot & GetHMDPoseSnapshot();
+
 	inline static FRotator GetHMDPureYaw_I(FRotator HMDRotation)
 	{
 		// Took this from UnityVRToolkit, no shame, I liked it
@@ -204,6 +204,26 @@ public:
 	~FVRGestureSplineDraw();
 };
 
+// Running SPRING state for a single database gesture (and mirroring) during streaming detection
+struct VREXPANSIONPLUGIN_API FVRGestureStreamState
+{
+	int32 GestureIndex;
+	bool bMirrorGesture;
+
+	// One DTW column, index 0 is the free start cell
+	TArray<float> Distances;
+	TArray<int32> StartSamples;
+
+	// Best match waiting to be confirmed
+	float BestDistance;
+	int32 BestStartSample;
+	int32 BestEndSample;
+
+	FVRGestureStreamState(int32 InGestureIndex, bool bInMirrorGesture, int32 TemplateLength);
+
+	void Reset();
+};
+
 /** Delegate for notification when the lever state changes. */
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FVRGestureDetectedSignature, uint8, GestureType, FString, DetectedGestureName, int, DetectedGestureIndex, UGesturesDatabase *, GestureDataBase);
 
@@ -284,6 +304,25 @@ public:
 	// Handle to our update timer
 	FTimerHandle TickGestureTimer_Handle;
 
+	// If true detection is done incrementally with subsequence DTW (SPRING) as samples arrive instead of re-running DTW on the whole buffer
+	// Costs template length per enabled gesture per new sample, matches are reported once no overlapping match can beat them
+	// Does not use maxSlope or firstThreshold
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRGestures|Streaming")
+		bool bUseStreamingDetection;
+
+	// Expected size of performed gestures when streaming, samples are scaled by the databases TargetGestureScale / this.
+	// Past samples can't be re-scaled when streaming so the scale is fixed when detection starts, gestures with bEnableScaling need this set.
+	// If 0 streamed samples are compared unscaled
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRGestures|Streaming")
+		float StreamingGestureSize;
+
+	TArray<FVRGestureStreamState> StreamStates;
+	int32 StreamSampleCount;
+	float StreamingScaler;
+
+	// DTW cells evaluated by the last RecognizeGesture or StreamGestureSample call, for profiling
+	int32 LastDetectionCells;
+
 	// Maximum vertical or horizontal steps in a row in the lookup table before throwing out a gesture
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "VRGestures")
 	int maxSlope;
@@ -353,8 +392,16 @@ public:
 	// Recognize gesture in the given sequence.
 	// It will always assume that the gesture ends on the last observation of that sequence.
 	// If the distance between the last observations of each sequence is too great, or if the overall DTW distance between the two sequences is too great, no gesture will be recognized.
-	void RecognizeGesture(FVRGesture inputGesture);
+	// Returns the index of the detected gesture in the database, or -1 if nothing was detected
+	int32 RecognizeGesture(FVRGesture inputGesture);
+
+
+	// Rebuilds the streaming states from the database, called when recording starts or is cleared
+	void ResetStreamingDetection();
 
+	// Feeds a new sample through the streaming detection
+	// Returns the index of the detected gesture in the database, or -1 if nothing was detected
+	int32 StreamGestureSample(const FVector & NewSample);
 
 	// Compute the min DTW distance between seq2 and all possible endings of seq1.
 	float dtw(FVRGesture seq1, FVRGesture seq2, bool bMirrorGesture = false, float Scaler = 1.f);
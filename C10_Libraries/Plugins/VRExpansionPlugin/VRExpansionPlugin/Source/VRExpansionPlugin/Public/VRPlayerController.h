@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "VRBPDatatypes.h"
 #include "VRPathFollowingComponent.h"
+#include "Grippables/GrippablePhysicsReplication.h"
 #include "GameFramework/PlayerController.h"
 #include "VRPlayerController.generated.h"
 
@@ -37,4 +38,13 @@ public:
 	* I am overriding this so that for VRCharacters it doesn't apply the view rotation and instead lets CMC handle it
 	*/
 	virtual void PlayerTick(float DeltaTime) override;
+
+	// If true then client auth throws of objects that we own are gathered up each replication update
+	// and sent to the server in a single RPC instead of each object sending its own
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VRPlayerController")
+		bool bBatchClientAuthThrows;
+
+	// Sends all of this clients active client auth throws for this update to the server
+	UFUNCTION(Unreliable, Server, WithValidation)
+		void Server_SendClientAuthThrows(const TArray<FVRClientAuthThrowRep> & ClientAuthThrows);
 };
\ No newline at end of file
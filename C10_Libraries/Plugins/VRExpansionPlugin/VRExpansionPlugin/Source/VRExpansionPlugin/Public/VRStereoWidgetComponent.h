@@ -7,6 +7,7 @@
 #include "VRGripInterface.h"
 #include "Components/WidgetComponent.h"
 #include "Components/StereoLayerComponent.h"
+#include "IStereoLayers.h"
 
 #include "VRStereoWidgetComponent.generated.h"
 
@@ -53,6 +54,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StereoLayer")
 		bool bUseEpicsWorldLockedStereo;
 
+	// Distance the layer transform can move before the layer is re-sent to the compositor, keeps head / pawn jitter from updating it every frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StereoLayer", meta = (ClampMin = "0", UIMin = "0", ClampMax = "1.0", UIMax = "1"))
+		float LayerTransformTolerance;
+
+	// Degrees the layer can rotate before it is re-sent to the compositor, same as LayerTransformTolerance but for head / pawn rotation jitter
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "StereoLayer", meta = (ClampMin = "0", UIMin = "0", ClampMax = "1.0", UIMax = "1"))
+		float LayerRotationTolerance;
+
+	// Creates, re-sends or destroys the compositor layer and marks its texture for update, called from the tick once the layer transform is known
+	void UpdateStereoLayer(IStereoLayers & StereoLayers, const FTransform & Transform, bool bCurrVisible, bool bWidgetDrew);
+
 	/**
 	* Change the layer's render priority, higher priorities render on top of lower priorities
 	* @param	InPriority: Priority value
@@ -139,4 +151,13 @@ private:
 	/** Last frames visiblity state **/
 	bool bLastVisible;
 
+	/** The widget has drawn into the render target at least once, the layer isn't shown before then **/
+	bool bHasWidgetDrawn;
+
+	/** The descriptor last sent to the compositor, the layer is only re-sent when the new one differs **/
+	IStereoLayers::FLayerDesc LastLayerDesc;
+
+	void BuildLayerDesc(const FTransform& Transform, IStereoLayers::FLayerDesc& LayerDsec) const;
+	bool IsLayerDescNearlyEqual(const IStereoLayers::FLayerDesc& A, const IStereoLayers::FLayerDesc& B) const;
+
 };
\ No newline at end of file